@@ -123,6 +123,22 @@ void AliCFContainer::Fill(const Double_t *var, Int_t istep, Double_t weight)
   fGrid[istep]->Fill(var,weight);
 }
 
+//____________________________________________________________________
+void AliCFContainer::FillSteps(const Double_t *var, UInt_t stepMask, Double_t weight)
+{
+  //
+  // Fills the grids of all the selection steps flagged in stepMask
+  // (bit i = step i, e.g. from AliCFManager::CheckParticleSteps)
+  // for a set of values of the input variables, with a given weight
+  //
+  if (fNStep<32 && (stepMask>>fNStep)) {
+    AliError("Non-existent selection step, grid was not filled for it");
+  }
+  for (Int_t istep=0; istep<fNStep && istep<32; istep++) {
+    if (stepMask & (1u<<istep)) fGrid[istep]->Fill(var,weight);
+  }
+}
+
 //____________________________________________________________________
 TH1* AliCFContainer::Project(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const
 {
@@ -62,6 +62,7 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  FillSteps(const Double_t *var, UInt_t stepMask, Double_t weight=1.) ; // fills all the steps flagged in stepMask (bit i = step i)
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
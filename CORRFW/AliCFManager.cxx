@@ -21,6 +21,7 @@
 // efficiency calculation.
 // prototype version by S.Arcelli silvia.arcelli@cern.ch
 ///////////////////////////////////////////////////////////////////////////
+#include "TMath.h"
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
 
@@ -104,15 +105,7 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
     return kTRUE;
   }
-  if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
-  }
-  return kTRUE;
+  return CheckCuts(fPartCutList[isel],obj,selcuts);
 }
 
 //_____________________________________________________________________________
@@ -125,17 +118,147 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
     AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
       return kTRUE;
   }
-  if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
+  return CheckCuts(fEvtCutList[isel],obj,selcuts);
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::GetParticleCutsMask(Int_t isel, const TString  &selcuts) const {
+  //
+  // bit mask of the cuts of particle-level selection isel matching selcuts
+  //
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return 0;
+  }
+  return GetCutsMask(fPartCutList[isel],selcuts);
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::GetEventCutsMask(Int_t isel, const TString  &selcuts) const {
+  //
+  // bit mask of the cuts of event-level selection isel matching selcuts
+  //
+
+  if(isel>=fNStepEvt){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
+    return 0;
+  }
+  return GetCutsMask(fEvtCutList[isel],selcuts);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckParticleCutsMask(Int_t isel, TObject *obj, UInt_t cutMask) const {
+  //
+  // check whether object obj passes the cuts of particle-level selection isel selected in cutMask
+  //
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return kTRUE;
+  }
+  return CheckCuts(fPartCutList[isel],obj,cutMask);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckEventCutsMask(Int_t isel, TObject *obj, UInt_t cutMask) const {
+  //
+  // check whether object obj passes the cuts of event-level selection isel selected in cutMask
+  //
+
+  if(isel>=fNStepEvt){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
+    return kTRUE;
+  }
+  return CheckCuts(fEvtCutList[isel],obj,cutMask);
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckParticleSteps(TObject *obj, UInt_t stepMask) const {
+  //
+  // check the particle-level selections flagged in stepMask (one bit per step),
+  // returns the bit mask of the selections passed by obj
+  //
+
+  UInt_t passed = 0;
+  Int_t nstep = TMath::Min(fNStepPart,32);
+  for (Int_t isel=0; isel<nstep; isel++) {
+    if (!(stepMask & (1u<<isel))) continue;
+    if (!fPartCutList || CheckCuts(fPartCutList[isel],obj,0xffffffff)) passed |= (1u<<isel);
+  }
+  return passed;
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckEventSteps(TObject *obj, UInt_t stepMask) const {
+  //
+  // check the event-level selections flagged in stepMask (one bit per step),
+  // returns the bit mask of the selections passed by obj
+  //
+
+  UInt_t passed = 0;
+  Int_t nstep = TMath::Min(fNStepEvt,32);
+  for (Int_t isel=0; isel<nstep; isel++) {
+    if (!(stepMask & (1u<<isel))) continue;
+    if (!fEvtCutList || CheckCuts(fEvtCutList[isel],obj,0xffffffff)) passed |= (1u<<isel);
+  }
+  return passed;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckCuts(const TObjArray *cuts, TObject *obj, const TString  &selcuts) const {
+  //
+  // check whether object obj passes the cuts of the list matching selcuts
+  // (same order as the list, stops at the first failing cut)
+  //
+
+  if(!cuts)return kTRUE;
+  Bool_t checkAll = selcuts.Contains("all");
+  Int_t ncuts = cuts->GetEntriesFast();
+  for (Int_t icut=0; icut<ncuts; icut++) {
+    AliCFCutBase *cut = (AliCFCutBase*)cuts->UncheckedAt(icut);
+    if (!cut) continue;
+    Bool_t checkCut = checkAll || CompareStrings(cut->GetName(),selcuts);
     if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckCuts(const TObjArray *cuts, TObject *obj, UInt_t cutMask) const {
+  //
+  // check whether object obj passes the cuts of the list selected in cutMask
+  // (same order as the list, stops at the first failing cut)
+  //
+
+  if(!cuts)return kTRUE;
+  Int_t ncuts = cuts->GetEntriesFast();
+  for (Int_t icut=0; icut<ncuts; icut++) {
+    if (icut<32 && !(cutMask & (1u<<icut))) continue;
+    AliCFCutBase *cut = (AliCFCutBase*)cuts->UncheckedAt(icut);
+    if(cut && !cut->IsSelected(obj)) return kFALSE;   
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::GetCutsMask(const TObjArray *cuts, const TString  &selcuts) const {
+  //
+  // resolves selcuts into a bit mask of the cuts of the list (bit i = i-th cut)
+  //
+
+  if(!cuts)return 0xffffffff;
+  Int_t ncuts = cuts->GetEntriesFast();
+  if (ncuts>32) AliWarning(Form("%d cuts in the list, the cuts beyond the 32nd will always be checked",ncuts));
+  if (selcuts.Contains("all")) return 0xffffffff;
+  UInt_t mask = 0;
+  for (Int_t icut=0; icut<TMath::Min(ncuts,32); icut++) {
+    TObject *cut = cuts->UncheckedAt(icut);
+    if (cut && CompareStrings(cut->GetName(),selcuts)) mask |= (1u<<icut);
+  }
+  return mask;
+}
+
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
@@ -116,6 +116,20 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Faster cut checkers: the selection string is resolved once (e.g. in the
+  //task initialisation) into a bit mask of the cuts of the list, bit i
+  //selecting the i-th cut (cuts beyond the 32nd are always checked)
+  virtual UInt_t GetEventCutsMask(Int_t isel, const TString &selcuts="all") const;
+  virtual UInt_t GetParticleCutsMask(Int_t isel, const TString &selcuts="all") const;
+  virtual Bool_t CheckEventCutsMask(Int_t isel, TObject *obj, UInt_t cutMask) const;
+  virtual Bool_t CheckParticleCutsMask(Int_t isel, TObject *obj, UInt_t cutMask) const;
+
+  //Check all the selection steps flagged in stepMask (all cuts of each step)
+  //in one call, returns the bit mask of the steps passed by obj, to be used
+  //with AliCFContainer::FillSteps
+  virtual UInt_t CheckEventSteps(TObject *obj, UInt_t stepMask=0xffffffff) const;
+  virtual UInt_t CheckParticleSteps(TObject *obj, UInt_t stepMask=0xffffffff) const;
+
  private:
   
   //number of steps
@@ -131,6 +145,9 @@ class AliCFManager : public TNamed
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  Bool_t CheckCuts(const TObjArray *cuts, TObject *obj, const TString &selcuts) const;
+  Bool_t CheckCuts(const TObjArray *cuts, TObject *obj, UInt_t cutMask) const;
+  UInt_t GetCutsMask(const TObjArray *cuts, const TString &selcuts) const;
 
   ClassDef(AliCFManager,2);
 };
@@ -92,6 +92,9 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <algorithm>
+#include <map>
+#include <utility>
 
 
 ClassImp(AliCFUnfolding)
@@ -123,6 +126,17 @@ AliCFUnfolding::AliCFUnfolding() :
   fCoordinates2N(0x0),
   fCoordinatesN_M(0x0),
   fCoordinatesN_T(0x0),
+  fSparseMeasuredCell(),
+  fSparseTrueCell(),
+  fSparseConditional(),
+  fSparseInverse(),
+  fMeasuredRowStart(),
+  fMeasuredRowBins(),
+  fTrueRowStart(),
+  fTrueRowBins(),
+  fMeasuredCellCoordinates(),
+  fTrueCellCoordinates(),
+  fSparseEstMeasured(),
   fRandomResponse(0x0),
   fRandomEfficiency(0x0),
   fRandomMeasured(0x0),
@@ -167,6 +181,17 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fCoordinates2N(0x0),
   fCoordinatesN_M(0x0),
   fCoordinatesN_T(0x0),
+  fSparseMeasuredCell(),
+  fSparseTrueCell(),
+  fSparseConditional(),
+  fSparseInverse(),
+  fMeasuredRowStart(),
+  fMeasuredRowBins(),
+  fTrueRowStart(),
+  fTrueRowBins(),
+  fMeasuredCellCoordinates(),
+  fTrueCellCoordinates(),
+  fSparseEstMeasured(),
   fRandomResponse((THnSparse*)response->Clone()),
   fRandomEfficiency((THnSparse*)efficiency->Clone()),
   fRandomMeasured((THnSparse*)measured->Clone()),
@@ -260,6 +285,8 @@ void AliCFUnfolding::Init() {
   
   // create the frame of the inverse response matrix
   fInverseResponse  = (THnSparse*) fResponse->Clone();
+  // the conditional matrix does not change anymore : store it in compressed sparse form
+  BuildSparseConditional();
   // create the frame of the unfolded spectrum
   fUnfolded = (THnSparse*) fPrior->Clone();
   fUnfolded->SetTitle("Unfolded");
@@ -295,22 +322,27 @@ void AliCFUnfolding::CreateEstMeasured() {
   // clean the measured estimate spectrum
   fMeasuredEstimate->Reset();
 
-  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
-  priorTimesEff->Multiply(fEfficiency);
-
-  // fill it
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t priorTimesEffValue = priorTimesEff->GetBinContent(fCoordinatesN_T);
-    Double_t fill = conditionalValue * priorTimesEffValue ;
-    
-    if (fill>0.) {
-      fMeasuredEstimate->AddBinContent(fCoordinatesN_M,fill);
-      fMeasuredEstimate->SetBinError(fCoordinatesN_M,0.);
+  std::vector<Double_t> priorTimesEff;
+  GetPriorTimesEfficiency(priorTimesEff);
+
+  // fill it : sparse matrix-vector product, row by row in the measured space
+  // within a row the bins are summed in the order of the conditional matrix
+  Int_t nMeasuredCells = fMeasuredRowStart.size()-1;
+  fSparseEstMeasured.assign(nMeasuredCells,0.);
+  std::vector<Long_t> firstBin(nMeasuredCells,-1);
+  for (Int_t iCell=0; iCell<nMeasuredCells; iCell++) {
+    for (Long_t iRow=fMeasuredRowStart[iCell]; iRow<fMeasuredRowStart[iCell+1]; iRow++) {
+      Long_t iBin = fMeasuredRowBins[iRow];
+      Double_t fill = fSparseConditional[iBin] * priorTimesEff[fSparseTrueCell[iBin]] ;
+      
+      if (fill>0.) {
+	fSparseEstMeasured[iCell] += fill;
+	if (firstBin[iCell]<0) firstBin[iCell] = iBin;
+      }
     }
   }
-  delete priorTimesEff ;
+  std::vector<Double_t> errors(nMeasuredCells,0.);
+  SetCellContents(fMeasuredEstimate,fMeasuredCellCoordinates,fSparseEstMeasured,errors,firstBin);
 }
 
 //______________________________________________________________
@@ -324,21 +356,20 @@ void AliCFUnfolding::CreateInvResponse() {
   // --> INV(i,j) = COND(i,j) * T(j) * E(j)   / SUM_k { COND(i,k) * T(k) }
   //
 
-  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
-  priorTimesEff->Multiply(fEfficiency);
+  std::vector<Double_t> priorTimesEff;
+  GetPriorTimesEfficiency(priorTimesEff);
 
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t estMeasuredValue   = fMeasuredEstimate->GetBinContent(fCoordinatesN_M);
-    Double_t priorTimesEffValue = priorTimesEff    ->GetBinContent(fCoordinatesN_T);
-    Double_t fill = (estMeasuredValue>0. ? conditionalValue * priorTimesEffValue / estMeasuredValue : 0. ) ;
-    if (fill>0. || fInverseResponse->GetBinContent(fCoordinates2N)>0.) {
-      fInverseResponse->SetBinContent(fCoordinates2N,fill);
-      fInverseResponse->SetBinError  (fCoordinates2N,0.);
+  // the inverse response matrix is a clone of the response matrix, like the conditional matrix : same bin numbering
+  for (Long_t iBin=0; iBin<(Long_t)fSparseConditional.size(); iBin++) {
+    Double_t estMeasuredValue   = fSparseEstMeasured[fSparseMeasuredCell[iBin]];
+    Double_t priorTimesEffValue = priorTimesEff[fSparseTrueCell[iBin]];
+    Double_t fill = (estMeasuredValue>0. ? fSparseConditional[iBin] * priorTimesEffValue / estMeasuredValue : 0. ) ;
+    if (fill>0. || fSparseInverse[iBin]>0.) {
+      fSparseInverse[iBin] = fill;
+      fInverseResponse->SetBinContent(iBin,fill);
+      fInverseResponse->SetBinError  (iBin,0.);
     }
   } 
-  delete priorTimesEff ;
 }
 
 //______________________________________________________________
@@ -423,22 +454,32 @@ void AliCFUnfolding::CreateUnfolded() {
   // otherwise the normal unfolded spectrum is created
 
   fUnfolded->Reset();
-  
-  for (Long_t iBin=0; iBin<fInverseResponse->GetNbins(); iBin++) {
-    Double_t invResponseValue = fInverseResponse->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t effValue      = fEfficiency->GetBinContent(fCoordinatesN_T);
-    Double_t measuredValue = fMeasured  ->GetBinContent(fCoordinatesN_M);
-    Double_t fill = (effValue>0. ? invResponseValue * measuredValue / effValue : 0.) ;
 
-    if (fill>0.) {
-      // set errors to zero
-      // true errors will be filled afterwards
-      Double_t err = 0.;
-      fUnfolded->SetBinError  (fCoordinatesN_T,err);
-      fUnfolded->AddBinContent(fCoordinatesN_T,fill);
+  std::vector<Double_t> effValues, measuredValues;
+  GetCellContents(fEfficiency,fTrueCellCoordinates,effValues);
+  GetCellContents(fMeasured,fMeasuredCellCoordinates,measuredValues);
+
+  // sparse matrix-vector product, row by row in the true space
+  Int_t nTrueCells = fTrueRowStart.size()-1;
+  std::vector<Double_t> unfolded(nTrueCells,0.), errors(nTrueCells,0.);
+  std::vector<Long_t> firstBin(nTrueCells,-1);
+  for (Int_t iCell=0; iCell<nTrueCells; iCell++) {
+    Double_t effValue = effValues[iCell];
+    for (Long_t iRow=fTrueRowStart[iCell]; iRow<fTrueRowStart[iCell+1]; iRow++) {
+      Long_t iBin = fTrueRowBins[iRow];
+      Double_t measuredValue = measuredValues[fSparseMeasuredCell[iBin]];
+      Double_t fill = (effValue>0. ? fSparseInverse[iBin] * measuredValue / effValue : 0.) ;
+
+      if (fill>0.) {
+	// the error is reset before each filling, hence it ends up as the last filled value
+	// true errors will be filled afterwards
+	unfolded[iCell] += fill;
+	errors[iCell] = fill;
+	if (firstBin[iCell]<0) firstBin[iCell] = iBin;
+      }
     }
   }
+  SetCellContents(fUnfolded,fTrueCellCoordinates,unfolded,errors,firstBin);
 }
 
 //______________________________________________________________
@@ -512,22 +553,22 @@ void AliCFUnfolding::CreateRandomizedDist() {
   //
 
   for (Long_t iBin=0; iBin<fResponseOrig->GetNbins(); iBin++) {
-    Double_t val = fResponseOrig->GetBinContent(iBin,fCoordinatesN_M); //used as mean
-    Double_t err = fResponseOrig->GetBinError(fCoordinatesN_M);        //used as sigma
+    Double_t val = fResponseOrig->GetBinContent(iBin);                 //used as mean
+    Double_t err = fResponseOrig->GetBinError(iBin);                   //used as sigma
     Double_t ran = fRandom3->Gaus(val,err);
     // random        = fRandom3->PoissonD(measuredValue); //doesn't work for normalized spectra, use Gaus (assuming raw counts in bin is large >10)
     fRandomResponse->SetBinContent(iBin,ran);
   }
   for (Long_t iBin=0; iBin<fEfficiencyOrig->GetNbins(); iBin++) {
-    Double_t val = fEfficiencyOrig->GetBinContent(iBin,fCoordinatesN_M); //used as mean
-    Double_t err = fEfficiencyOrig->GetBinError(fCoordinatesN_M);        //used as sigma
+    Double_t val = fEfficiencyOrig->GetBinContent(iBin);                 //used as mean
+    Double_t err = fEfficiencyOrig->GetBinError(iBin);                   //used as sigma
     Double_t ran = fRandom3->Gaus(val,err);
     // random        = fRandom3->PoissonD(measuredValue); //doesn't work for normalized spectra, use Gaus (assuming raw counts in bin is large >10)
     fRandomEfficiency->SetBinContent(iBin,ran);
   }
   for (Long_t iBin=0; iBin<fMeasuredOrig->GetNbins(); iBin++) {
-    Double_t val = fMeasuredOrig->GetBinContent(iBin,fCoordinatesN_M); //used as mean
-    Double_t err = fMeasuredOrig->GetBinError(fCoordinatesN_M);        //used as sigma
+    Double_t val = fMeasuredOrig->GetBinContent(iBin);                 //used as mean
+    Double_t err = fMeasuredOrig->GetBinError(iBin);                   //used as sigma
     Double_t ran = fRandom3->Gaus(val,err);
     // random        = fRandom3->PoissonD(measuredValue); //doesn't work for normalized spectra, use Gaus (assuming raw counts in bin is large >10)
     fRandomMeasured->SetBinContent(iBin,ran);
@@ -620,6 +661,114 @@ void AliCFUnfolding::CreateConditional() {
 }
 //______________________________________________________________
 
+static void FillSparseRows(const std::vector<Int_t>& cellOfBin, Int_t nCells, std::vector<Long_t>& rowStart, std::vector<Long_t>& rowBins) {
+  //
+  // groups the bins by cell (counting sort) : the bins of cell i are rowBins[rowStart[i]] ... rowBins[rowStart[i+1]-1]
+  // the bins keep their original order within each cell
+  //
+  rowStart.assign(nCells+1,0);
+  for (UInt_t iBin=0; iBin<cellOfBin.size(); iBin++) rowStart[cellOfBin[iBin]+1]++;
+  for (Int_t iCell=0; iCell<nCells; iCell++) rowStart[iCell+1] += rowStart[iCell];
+  rowBins.resize(cellOfBin.size());
+  std::vector<Long_t> next(rowStart.begin(),rowStart.end()-1);
+  for (UInt_t iBin=0; iBin<cellOfBin.size(); iBin++) rowBins[next[cellOfBin[iBin]]++] = iBin;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::BuildSparseConditional() {
+  //
+  // stores the conditional matrix as a list of bins, each with its content and the index of its cell
+  // in the measured and in the true space, and groups the bins by measured and by true cell.
+  // The bayesian iterations then become sparse matrix-vector products which read the THnSparse spectra
+  // once per cell instead of searching them by coordinates for each bin of the response matrix.
+  // The inverse response matrix is a clone of the response matrix like the conditional matrix : same bin numbering
+  //
+
+  Long_t nBins = fConditional->GetNbins();
+  fSparseMeasuredCell.resize(nBins);
+  fSparseTrueCell    .resize(nBins);
+  fSparseConditional .resize(nBins);
+  fSparseInverse     .resize(nBins);
+  fMeasuredCellCoordinates.clear();
+  fTrueCellCoordinates    .clear();
+
+  // a cell is identified by its global bin number (including under/overflow bins)
+  std::vector<Long64_t> strides(2*fNVariables,1);
+  for (Int_t iVar=1; iVar<fNVariables; iVar++) {
+    strides[iVar]             = strides[iVar-1]             * (fConditional->GetAxis(iVar-1)            ->GetNbins()+2);
+    strides[iVar+fNVariables] = strides[iVar+fNVariables-1] * (fConditional->GetAxis(iVar+fNVariables-1)->GetNbins()+2);
+  }
+
+  std::map<Long64_t,Int_t> measuredCells, trueCells;
+  for (Long_t iBin=0; iBin<nBins; iBin++) {
+    fSparseConditional[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    fSparseInverse[iBin]     = fInverseResponse->GetBinContent(iBin);
+    GetCoordinates();
+    Long64_t measuredKey = 0, trueKey = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+      measuredKey += strides[iVar]             * fCoordinatesN_M[iVar];
+      trueKey     += strides[iVar+fNVariables] * fCoordinatesN_T[iVar];
+    }
+    std::pair<std::map<Long64_t,Int_t>::iterator,bool> measuredCell = measuredCells.insert(std::make_pair(measuredKey,(Int_t)measuredCells.size()));
+    if (measuredCell.second) fMeasuredCellCoordinates.insert(fMeasuredCellCoordinates.end(),fCoordinatesN_M,fCoordinatesN_M+fNVariables);
+    fSparseMeasuredCell[iBin] = measuredCell.first->second;
+    std::pair<std::map<Long64_t,Int_t>::iterator,bool> trueCell = trueCells.insert(std::make_pair(trueKey,(Int_t)trueCells.size()));
+    if (trueCell.second) fTrueCellCoordinates.insert(fTrueCellCoordinates.end(),fCoordinatesN_T,fCoordinatesN_T+fNVariables);
+    fSparseTrueCell[iBin] = trueCell.first->second;
+  }
+
+  FillSparseRows(fSparseMeasuredCell,measuredCells.size(),fMeasuredRowStart,fMeasuredRowBins);
+  FillSparseRows(fSparseTrueCell    ,trueCells    .size(),fTrueRowStart    ,fTrueRowBins);
+  AliDebug(1,Form("conditional matrix has %ld bins in %d measured and %d true cells",nBins,(Int_t)measuredCells.size(),(Int_t)trueCells.size()));
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetCellContents(const THnSparse* hist, const std::vector<Int_t>& cellCoordinates, std::vector<Double_t>& values) const {
+  //
+  // reads the content of hist in each cell (fNVariables coordinates per cell)
+  //
+  Int_t nCells = cellCoordinates.size()/fNVariables;
+  values.resize(nCells);
+  for (Int_t iCell=0; iCell<nCells; iCell++) values[iCell] = hist->GetBinContent(&cellCoordinates[iCell*fNVariables]);
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetPriorTimesEfficiency(std::vector<Double_t>& values) const {
+  //
+  // prior distribution (T) times efficiency (E) in each true cell
+  //
+  std::vector<Double_t> effValues;
+  GetCellContents(fPrior     ,fTrueCellCoordinates,values);
+  GetCellContents(fEfficiency,fTrueCellCoordinates,effValues);
+  for (UInt_t iCell=0; iCell<values.size(); iCell++) values[iCell] *= effValues[iCell];
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::SetCellContents(THnSparse* hist, const std::vector<Int_t>& cellCoordinates, const std::vector<Double_t>& values,
+				     const std::vector<Double_t>& errors, const std::vector<Long_t>& firstBin) const {
+  //
+  // sets content and error of the filled cells (firstBin>=0) of hist
+  // the cells are created in the order of their first filling bin, as the bin by bin filling did
+  //
+  std::vector<std::pair<Long_t,Int_t> > filledCells;
+  for (UInt_t iCell=0; iCell<firstBin.size(); iCell++) {
+    if (firstBin[iCell]>=0) filledCells.push_back(std::make_pair(firstBin[iCell],(Int_t)iCell));
+  }
+  std::sort(filledCells.begin(),filledCells.end());
+  for (UInt_t iFilled=0; iFilled<filledCells.size(); iFilled++) {
+    Int_t iCell = filledCells[iFilled].second;
+    const Int_t* coordinates = &cellCoordinates[iCell*fNVariables];
+    hist->SetBinContent(coordinates,values[iCell]);
+    hist->SetBinError  (coordinates,errors[iCell]);
+  }
+}
+
+//______________________________________________________________
+
 Int_t AliCFUnfolding::GetDOF() {
   //
   // number of dof = number of bins
@@ -13,6 +13,7 @@
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
+#include <vector>
 
 class TF1;
 class TRandom3;
@@ -101,6 +102,19 @@ class AliCFUnfolding : public TNamed {
 	Int_t         *fCoordinatesN_M;    // Coordinates in measured space
 	Int_t         *fCoordinatesN_T;    // Coordinates in true space
 
+  /* compressed sparse representation of the conditional matrix, built once in Init() */
+  std::vector<Int_t>    fSparseMeasuredCell;      //! measured cell of each bin of the conditional matrix
+  std::vector<Int_t>    fSparseTrueCell;          //! true cell of each bin of the conditional matrix
+  std::vector<Double_t> fSparseConditional;       //! content of each bin of the conditional matrix
+  std::vector<Double_t> fSparseInverse;           //! content of each bin of the inverse response matrix (same bin numbering)
+  std::vector<Long_t>   fMeasuredRowStart;        //! offset of each measured cell in fMeasuredRowBins
+  std::vector<Long_t>   fMeasuredRowBins;         //! bins of the conditional matrix grouped by measured cell
+  std::vector<Long_t>   fTrueRowStart;            //! offset of each true cell in fTrueRowBins
+  std::vector<Long_t>   fTrueRowBins;             //! bins of the conditional matrix grouped by true cell
+  std::vector<Int_t>    fMeasuredCellCoordinates; //! coordinates of the measured cells (fNVariables per cell)
+  std::vector<Int_t>    fTrueCellCoordinates;     //! coordinates of the true cells (fNVariables per cell)
+  std::vector<Double_t> fSparseEstMeasured;       //! measured estimate in each measured cell
+
 
   /* correlated error calculation */
   THnSparse     *fRandomResponse;    // Randomized distribution for each bin of the response matrix     to calculate correlated errors
@@ -121,6 +135,11 @@ class AliCFUnfolding : public TNamed {
   void     CreateInvResponse();     // creates the inverse response function (Bayes Theorem) from the conditional matrix and the prior distribution
   void     CreateUnfolded();        // creates the unfolded spectrum from the inverse response matrix and the measured distribution
   void     CreateFlatPrior();       // creates a flat a priori distribution in case the one given in the constructor is null
+  void     BuildSparseConditional();  // builds the compressed sparse representation of the conditional matrix
+  void     GetPriorTimesEfficiency(std::vector<Double_t>& values) const; // prior times efficiency in each true cell
+  void     GetCellContents(const THnSparse* hist, const std::vector<Int_t>& cellCoordinates, std::vector<Double_t>& values) const; // reads hist in the given cells
+  void     SetCellContents(THnSparse* hist, const std::vector<Int_t>& cellCoordinates, const std::vector<Double_t>& values,
+			   const std::vector<Double_t>& errors, const std::vector<Long_t>& firstBin) const; // writes the filled cells into hist
   Double_t GetChi2();               // returns the chi2 between unfolded and prior spectra
   Short_t  Smooth();                // function calling smoothing methods
   Short_t  SmoothUsingFunction();   // smoothes the unfolded spectrum using a fit function
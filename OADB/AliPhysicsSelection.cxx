@@ -123,6 +123,7 @@ fIsPP(kFALSE),
 fReadOCDB(kFALSE),
 fUseBXNumbers(0),
 fUsingCustomClasses(0),
+fFillTriggerHistograms(kTRUE),
 fCollTrigClasses(),
 fBGTrigClasses(),
 fTriggerAnalysis(),
@@ -153,6 +154,7 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fReadOCDB(kFALSE),
  fUseBXNumbers(0),
  fUsingCustomClasses(0),
+ fFillTriggerHistograms(kTRUE),
  fCollTrigClasses(),
  fBGTrigClasses(),
  fTriggerAnalysis(),
@@ -280,7 +282,7 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
   for (size_t i = 0; i < bits.size(); ++i) {
     typedef AliTriggerAnalysis::Trigger Trigger;
     Trigger bit = static_cast<Trigger>(bits[i] | offline_flag);
-    paras[i] = triggerAnalysis->EvaluateTrigger(event, bit);
+    paras[i] = triggerAnalysis->EvaluateTriggerCached(event, bit);
   }
   Double_t dummy_val[] = {0};
   return trg_formula.EvalPar(dummy_val, paras.data());
@@ -302,6 +304,12 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  // all AliTriggerAnalysis objects are configured identically and only keep the control histograms
+  // separate per trigger class, hence one of them evaluates the triggers for all classes and each
+  // trigger is evaluated only once per event
+  AliTriggerAnalysis* triggerEvaluator = static_cast<AliTriggerAnalysis*> (fTriggerAnalysis.At(0));
+  if (triggerEvaluator) triggerEvaluator->ResetEvaluationCache();
+  
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
@@ -315,9 +323,9 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     Int_t triggerLogic = 0;
     UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
-    triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
+    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerEvaluator, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
+    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerEvaluator, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    if (fFillTriggerHistograms) triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
     accept |= singleTriggerResult;
@@ -75,6 +75,7 @@ public:
   virtual Long64_t Merge(TCollection* list);
   void SaveHistograms(const char* folder = 0);
   void ApplyPileupCuts(Bool_t val) { fPileupCutsEnabled = val; }
+  void SetFillTriggerHistograms(Bool_t val = kTRUE) { fFillTriggerHistograms = val; }
   
   const TList* GetCollisionTriggerClasses() const { return &fCollTrigClasses; }
   const TList* GetBGTriggerClasses()        const { return &fBGTrigClasses; }
@@ -112,6 +113,7 @@ protected:
   Bool_t fReadOCDB;           // Flag to read thresholds from OCDB
   Bool_t fUseBXNumbers;       // Explicitly select "good" bunch crossing numbers
   Bool_t fUsingCustomClasses; // flag that is set if custom trigger classes are defined
+  Bool_t fFillTriggerHistograms; // flag to fill the control histograms of the AliTriggerAnalysis objects (switch off in production trains to save time; the statistics histogram stays empty then)
   TList fCollTrigClasses;     // trigger class identifying collision candidates
   TList fBGTrigClasses;       // trigger classes identifying background events
   TList fTriggerAnalysis;     // list of AliTriggerAnalysis objects (several are needed to keep the control histograms separate per trigger class)
@@ -128,7 +130,7 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
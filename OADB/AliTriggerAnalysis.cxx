@@ -118,10 +118,12 @@ fTriggerClasses(new TMap)
   fHistList->SetName("histos");
   fHistList->SetOwner();
   fTriggerClasses->SetOwner();
+  ResetEvaluationCache();
 }
 
 //-------------------------------------------------------------------------------------------------
 void AliTriggerAnalysis::SetParameters(AliOADBTriggerAnalysis* oadb){
+  ResetEvaluationCache();
   fZDCCutRefSumCorr     = oadb->GetZDCCutRefSumCorr();
   fZDCCutRefDeltaCorr   = oadb->GetZDCCutRefDeltaCorr();
   fZDCCutSigmaSumCorr   = oadb->GetZDCCutSigmaSumCorr();
@@ -549,6 +551,27 @@ Int_t AliTriggerAnalysis::EvaluateTrigger(const AliVEvent* event, Trigger trigge
 }
 
 
+//-------------------------------------------------------------------------------------------------
+Int_t AliTriggerAnalysis::EvaluateTriggerCached(const AliVEvent* event, Trigger trigger){
+  // evaluates a given trigger like EvaluateTrigger, but each trigger (online and offline separately)
+  // is evaluated only once until ResetEvaluationCache is called, which has to be done for every event
+  // the cache is bypassed if the SPD FO efficiency is simulated, since those decisions are random
+  if (fSPDGFOEfficiency) return EvaluateTrigger(event, trigger);
+  
+  UInt_t index = (UInt_t) trigger % (UInt_t) kStartOfFlags;
+  if (trigger & kOfflineFlag) index += kStartOfFlags;
+  if (fEvaluationCache[index] == kEvaluationNotCached) fEvaluationCache[index] = EvaluateTrigger(event, trigger);
+  return fEvaluationCache[index];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void AliTriggerAnalysis::ResetEvaluationCache(){
+  // forgets the trigger decisions cached by EvaluateTriggerCached
+  for (Int_t i=0; i<2*kStartOfFlags; i++) fEvaluationCache[i] = kEvaluationNotCached;
+}
+
+
 //-------------------------------------------------------------------------------------------------
 Bool_t AliTriggerAnalysis::IsOfflineTriggerFired(const AliVEvent* event, Trigger trigger){
   // checks if an event has been triggered "offline"
@@ -46,10 +46,12 @@ public:
   virtual ~AliTriggerAnalysis();
   void EnableHistograms(Bool_t isLowFlux = kFALSE);
   void SetAnalyzeMC(Bool_t flag = kTRUE) { fMC = flag; }
-  void ApplyPileupCuts(Bool_t val = kTRUE) { fPileupCutsEnabled = val; }
+  void ApplyPileupCuts(Bool_t val = kTRUE) { fPileupCutsEnabled = val; ResetEvaluationCache(); }
   void SetParameters(AliOADBTriggerAnalysis* oadb);
   Bool_t IsTriggerFired(const AliVEvent* event, Trigger trigger);
   Int_t EvaluateTrigger(const AliVEvent* event, Trigger trigger);
+  Int_t EvaluateTriggerCached(const AliVEvent* event, Trigger trigger);
+  void ResetEvaluationCache();
   Bool_t IsTriggerBitFired(const AliVEvent* event, ULong64_t tclass) const;
   Bool_t IsOfflineTriggerFired(const AliVEvent* event, Trigger trigger);
   
@@ -106,6 +108,9 @@ protected:
   Bool_t fMC;                // flag if MC is analyzed
   Bool_t fPileupCutsEnabled; // flag to enable/disable cuts sensitive to in/out-of-bunch pileup
   
+  enum { kEvaluationNotCached = -0x7fffffff };
+  Int_t fEvaluationCache[2*kStartOfFlags]; //! results of EvaluateTrigger for the current event (online, offline), see EvaluateTriggerCached
+  
   TList* fHistList;          //
   TH1F* fHistStat;           //!
   TH1F* fHistFiredBitsSPD;   //! fired hardware bits
@@ -17,6 +17,8 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
+#include <algorithm>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -75,6 +77,10 @@ fUseTrackDCACut(0),
 fAODBranchList(0x0),
 fCTSTracks(0x0),             fEMCALClusters(0x0),
 fDCALClusters(0x0),          fPHOSClusters(0x0),
+fUseEtaPhiCellIndex(kTRUE),  fEtaPhiCellNEta(0),              fEtaPhiCellNPhi(0),
+fEtaPhiCellEtaRange(),       fEtaPhiCellStatus(),
+fEtaPhiCellPt(),             fEtaPhiCellEta(),                fEtaPhiCellPhi(),
+fEtaPhiCellFirst(),          fEtaPhiCellEntries(),
 fEMCALCells(0x0),            fPHOSCells(0x0),
 fInputEvent(0x0),            fOutputEvent(0x0),fMC(0x0),
 fFillCTS(0),                 fFillEMCAL(0),
@@ -1040,6 +1046,14 @@ void AliCaloTrackReader::InitParameters()
   fEMCALNCellsCut    = 0; // open, 1; // standard          
   fPHOSNCellsCut     = 0; // open, 2; // standard
   
+  // Eta-phi cell index of tracks and clusters, cells of about 0.1x0.1
+  fUseEtaPhiCellIndex    = kTRUE;
+  fEtaPhiCellNEta        = 20;
+  fEtaPhiCellNPhi        = 63;
+  fEtaPhiCellEtaRange[0] = -1.;
+  fEtaPhiCellEtaRange[1] =  1.;
+  for(Int_t i = 0; i < 3; i++) fEtaPhiCellStatus[i] = 0;
+  
   //Track DCA cuts
   // dca_xy cut = 0.0105+0.0350/TMath::Power(pt,1.1);
   fTrackDCACut[0] = 0.0105;
@@ -3043,6 +3057,8 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("Use EMCAL Cells =     %d\n",     fFillEMCALCells) ;
   printf("Use PHOS  Cells =     %d\n",     fFillPHOSCells) ;
   printf("Track status    =     %d\n", (Int_t) fTrackStatus) ;
+  printf("Eta-phi cell index = %d, %d eta cells in [%2.2f,%2.2f], %d phi cells\n",
+         fUseEtaPhiCellIndex, fEtaPhiCellNEta, fEtaPhiCellEtaRange[0], fEtaPhiCellEtaRange[1], fEtaPhiCellNPhi) ;
 
   printf("Track Mult Eta Cut =  %2.2f\n",  fTrackMultEtaCut) ;
 
@@ -3176,6 +3192,172 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
   //printf("AliCaloTrackReader::RemapMCLabelForAODs() - Label not found set to -1 \n");
 }
 
+//___________________________________________________________
+/// Fill the eta-phi cell index of one of the reader arrays.
+/// The kinematics of each entry are calculated here once per event,
+/// in the same way as in the cone searches: track momentum, or cluster
+/// momentum assuming it comes from its event vertex in straight line.
+/// If the array contains an unexpected object, the slot is marked as
+/// not indexable and the cone searches loop on the full array.
+///
+/// \param slot: 0 for fCTSTracks, 1 for fEMCALClusters, 2 for fPHOSClusters.
+//___________________________________________________________
+void AliCaloTrackReader::FillEtaPhiCellIndex(Int_t slot)
+{
+  TObjArray * list = fCTSTracks;
+  if      ( slot == 1 ) list = fEMCALClusters;
+  else if ( slot == 2 ) list = fPHOSClusters;
+  
+  fEtaPhiCellStatus[slot] = -1;
+  
+  if ( !list || fEtaPhiCellNEta <= 0 || fEtaPhiCellNPhi <= 0 ) return ;
+  
+  Int_t nEntries = list->GetEntriesFast();
+  Int_t nCells   = fEtaPhiCellNEta*fEtaPhiCellNPhi;
+  
+  std::vector<Float_t> & pt    = fEtaPhiCellPt     [slot];
+  std::vector<Float_t> & eta   = fEtaPhiCellEta    [slot];
+  std::vector<Float_t> & phi   = fEtaPhiCellPhi    [slot];
+  std::vector<Int_t>   & first = fEtaPhiCellFirst  [slot];
+  std::vector<Int_t>   & cells = fEtaPhiCellEntries[slot];
+  
+  pt .resize(nEntries);
+  eta.resize(nEntries);
+  phi.resize(nEntries);
+  cells.resize(nEntries);
+  first.assign(nCells+1, 0);
+  
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    TObject * obj = list->At(i);
+    
+    if ( slot == 0 )
+    {
+      AliVTrack * track = dynamic_cast<AliVTrack*>(obj);
+      if ( !track ) return ;
+      
+      TVector3 trackVector(track->Px(),track->Py(),track->Pz());
+      pt [i] = trackVector.Pt();
+      eta[i] = trackVector.Eta();
+      phi[i] = trackVector.Phi();
+    }
+    else
+    {
+      AliVCluster * calo = dynamic_cast<AliVCluster*>(obj);
+      if ( !calo ) return ;
+      
+      Int_t evtIndex = 0 ;
+      if ( fMixedEvent ) evtIndex = fMixedEvent->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      calo->GetMomentum(fMomentum,GetVertex(evtIndex)) ;
+      pt [i] = fMomentum.Pt();
+      eta[i] = fMomentum.Eta();
+      phi[i] = fMomentum.Phi();
+    }
+    
+    if ( phi[i] < 0 ) phi[i]+=TMath::TwoPi();
+    
+    first[GetEtaPhiCellIndexEtaBin(eta[i])*fEtaPhiCellNPhi+GetEtaPhiCellIndexPhiBin(phi[i])+1]++;
+  }
+  
+  // Counting sort of the entries per cell, entries keep their order inside a cell
+  for(Int_t icell = 0; icell < nCells; icell++) first[icell+1] += first[icell];
+  
+  std::vector<Int_t> next(first.begin(), first.end()-1);
+  for(Int_t i = 0; i < nEntries; i++)
+    cells[next[GetEtaPhiCellIndexEtaBin(eta[i])*fEtaPhiCellNPhi+GetEtaPhiCellIndexPhiBin(phi[i])]++] = i;
+  
+  fEtaPhiCellStatus[slot] = 1;
+}
+
+//___________________________________________________________
+/// \return eta cell of the index, entries outside the range go to the first/last cell.
+//___________________________________________________________
+Int_t AliCaloTrackReader::GetEtaPhiCellIndexEtaBin(Float_t eta) const
+{
+  Float_t width = (fEtaPhiCellEtaRange[1]-fEtaPhiCellEtaRange[0]) / fEtaPhiCellNEta;
+  
+  if ( eta <= fEtaPhiCellEtaRange[0] ) return 0;
+  if ( eta >= fEtaPhiCellEtaRange[1] ) return fEtaPhiCellNEta-1;
+  
+  return TMath::Min(Int_t((eta-fEtaPhiCellEtaRange[0]) / width), fEtaPhiCellNEta-1);
+}
+
+//___________________________________________________________
+/// \return phi cell of the index, phi expected in 0 to 2 pi, clamped to the first/last cell otherwise.
+//___________________________________________________________
+Int_t AliCaloTrackReader::GetEtaPhiCellIndexPhiBin(Float_t phi) const
+{
+  if ( phi <= 0                ) return 0;
+  if ( phi >= TMath::TwoPi()   ) return fEtaPhiCellNPhi-1;
+  
+  return TMath::Min(Int_t(phi*fEtaPhiCellNPhi / TMath::TwoPi()), fEtaPhiCellNPhi-1);
+}
+
+//___________________________________________________________
+/// Get the eta-phi cell index slot of a reader array, filling
+/// the index the first time it is requested in the event.
+///
+/// \param list: fCTSTracks, fEMCALClusters or fPHOSClusters.
+/// \return index slot, -1 if the index is off, the array is not one of
+/// the reader arrays or it can not be indexed.
+//___________________________________________________________
+Int_t AliCaloTrackReader::GetEtaPhiCellIndexSlot(const TObjArray * list)
+{
+  if ( !fUseEtaPhiCellIndex || !list ) return -1;
+  
+  Int_t slot = -1;
+  if      ( list == fCTSTracks     ) slot = 0;
+  else if ( list == fEMCALClusters ) slot = 1;
+  else if ( list == fPHOSClusters  ) slot = 2;
+  else                               return -1;
+  
+  if ( fEtaPhiCellStatus[slot] == 0 ) FillEtaPhiCellIndex(slot);
+  
+  if ( fEtaPhiCellStatus[slot] < 0 ) return -1;
+  
+  return slot;
+}
+
+//___________________________________________________________
+/// Get the array entries that can contribute to the isolation cone
+/// of a candidate or to its UE eta/phi bands: all the entries in the
+/// eta cells overlapping etaC +- coneSize, and, outside them, the entries
+/// in the phi cells overlapping phiC +- coneSize (not wrapped, as the bands).
+/// Entries are returned in the order of the original array.
+///
+/// \param slot: index slot, from GetEtaPhiCellIndexSlot().
+/// \param etaC: candidate eta.
+/// \param phiC: candidate phi, in 0 to 2 pi.
+/// \param coneSize: isolation cone size.
+/// \param entries: array entries, output.
+//___________________________________________________________
+void AliCaloTrackReader::GetEtaPhiCellIndexEntries(Int_t slot, Float_t etaC, Float_t phiC, Float_t coneSize,
+                                                   std::vector<Int_t> & entries) const
+{
+  entries.clear();
+  
+  const std::vector<Int_t> & first = fEtaPhiCellFirst  [slot];
+  const std::vector<Int_t> & cells = fEtaPhiCellEntries[slot];
+  
+  Int_t etaMin = GetEtaPhiCellIndexEtaBin(etaC-coneSize);
+  Int_t etaMax = GetEtaPhiCellIndexEtaBin(etaC+coneSize);
+  Int_t phiMin = GetEtaPhiCellIndexPhiBin(phiC-coneSize);
+  Int_t phiMax = GetEtaPhiCellIndexPhiBin(phiC+coneSize);
+  
+  for(Int_t ieta = 0; ieta < fEtaPhiCellNEta; ieta++)
+  {
+    Bool_t inEtaBand = ( ieta >= etaMin && ieta <= etaMax );
+    
+    Int_t cellMin = ieta*fEtaPhiCellNPhi + (inEtaBand ? 0                 : phiMin);
+    Int_t cellMax = ieta*fEtaPhiCellNPhi + (inEtaBand ? fEtaPhiCellNPhi-1 : phiMax);
+    
+    entries.insert(entries.end(), cells.begin()+first[cellMin], cells.begin()+first[cellMax+1]);
+  }
+  
+  std::sort(entries.begin(), entries.end());
+}
+
 //___________________________________
 /// Reset lists, called in AliAnaCaloTrackCorrMaker.
 //___________________________________
@@ -3185,6 +3367,8 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  for(Int_t i = 0; i < 3; i++) fEtaPhiCellStatus[i] = 0;
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
@@ -30,6 +30,7 @@ class TObjArray ;
 class TTree ;
 class TArrayI ;
 #include <TRandom3.h>
+#include <vector>
 
 //--- ANALYSIS system ---
 #include "AliVEvent.h"
@@ -301,6 +302,24 @@ public:
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
+  // Per event eta-phi cell index of the tracks/clusters arrays, for cone searches
+  
+  void             SwitchOnEtaPhiCellIndex()               { fUseEtaPhiCellIndex = kTRUE  ; }
+  void             SwitchOffEtaPhiCellIndex()              { fUseEtaPhiCellIndex = kFALSE ; }
+  Bool_t           IsEtaPhiCellIndexOn()             const { return fUseEtaPhiCellIndex   ; }
+  void             SetEtaPhiCellIndexBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi)
+  { fEtaPhiCellNEta = nEta ; fEtaPhiCellEtaRange[0] = etaMin ; fEtaPhiCellEtaRange[1] = etaMax ; fEtaPhiCellNPhi = nPhi ; }
+  
+  void             FillEtaPhiCellIndex(Int_t slot) ;
+  Int_t            GetEtaPhiCellIndexEtaBin(Float_t eta) const ;
+  Int_t            GetEtaPhiCellIndexPhiBin(Float_t phi) const ;
+  Int_t            GetEtaPhiCellIndexSlot(const TObjArray * list) ;
+  void             GetEtaPhiCellIndexEntries(Int_t slot, Float_t etaC, Float_t phiC, Float_t coneSize,
+                                             std::vector<Int_t> & entries) const ;
+  Float_t          GetEtaPhiCellIndexPt (Int_t slot, Int_t i) const { return fEtaPhiCellPt [slot][i] ; }
+  Float_t          GetEtaPhiCellIndexEta(Int_t slot, Int_t i) const { return fEtaPhiCellEta[slot][i] ; }
+  Float_t          GetEtaPhiCellIndexPhi(Int_t slot, Int_t i) const { return fEtaPhiCellPhi[slot][i] ; }
+  
   //-------------------------------------
   // Event/track selection methods
   //-------------------------------------
@@ -790,6 +809,18 @@ public:
   /// Temporal array with PHOS  CaloClusters.
   TObjArray      * fPHOSClusters ;                 //-> 
   
+  // Per event eta-phi cell index of fCTSTracks (slot 0), fEMCALClusters (slot 1) and fPHOSClusters (slot 2)
+  Bool_t           fUseEtaPhiCellIndex;            ///<  Index the arrays in eta-phi cells, to restrict cone searches.
+  Int_t            fEtaPhiCellNEta;                ///<  Number of eta cells of the index.
+  Int_t            fEtaPhiCellNPhi;                ///<  Number of phi cells of the index, covering 0 to 2 pi.
+  Float_t          fEtaPhiCellEtaRange[2];         ///<  Eta range of the index, entries outside go to the first/last cell.
+  Int_t            fEtaPhiCellStatus[3];           //!<! Index state per slot: 0 not filled in this event, 1 filled, -1 array not indexable.
+  std::vector<Float_t> fEtaPhiCellPt [3];          //!<! pT of each array entry.
+  std::vector<Float_t> fEtaPhiCellEta[3];          //!<! Eta of each array entry.
+  std::vector<Float_t> fEtaPhiCellPhi[3];          //!<! Phi of each array entry, in 0 to 2 pi.
+  std::vector<Int_t>   fEtaPhiCellFirst[3];        //!<! Position in fEtaPhiCellEntries of the first entry of each cell, one more for the end.
+  std::vector<Int_t>   fEtaPhiCellEntries[3];      //!<! Array entries ordered by cell.
+  
   AliVCaloCells  * fEMCALCells ;                   //!<! Temporal array with EMCAL AliVCaloCells.
   AliVCaloCells  * fPHOSCells ;                    //!<! Temporal array with PHOS  AliVCaloCells.
 
@@ -974,7 +1005,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,77) ;
+  ClassDef(AliCaloTrackReader,78) ;
   /// \endcond
 
 } ;
@@ -54,7 +54,8 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fConeEntries()
 {
   InitParameters();
 }
@@ -460,8 +461,20 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    // If the reader indexed this array, loop only on the tracks that
+    // can be in the cone or in the UE bands, with their kinematics cached
+    Int_t nTracks = plCTS->GetEntries();
+    Int_t slot    = reader->GetEtaPhiCellIndexSlot(plCTS);
+    if ( slot >= 0 )
     {
+      reader->GetEtaPhiCellIndexEntries(slot, etaC, phiC, fConeSize, fConeEntries);
+      nTracks = fConeEntries.size();
+    }
+    
+    for(Int_t itr = 0; itr < nTracks ; itr ++ )
+    {
+      Int_t ipr = ( slot >= 0 ) ? fConeEntries[itr] : itr;
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -482,10 +495,19 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
           if ( contained ) continue ;
         }
         
-        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-        pt  = fTrackVector.Pt();
-        eta = fTrackVector.Eta();
-        phi = fTrackVector.Phi() ;
+        if ( slot >= 0 )
+        {
+          pt  = reader->GetEtaPhiCellIndexPt (slot,ipr);
+          eta = reader->GetEtaPhiCellIndexEta(slot,ipr);
+          phi = reader->GetEtaPhiCellIndexPhi(slot,ipr);
+        }
+        else
+        {
+          fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+          pt  = fTrackVector.Pt();
+          eta = fTrackVector.Eta();
+          phi = fTrackVector.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
@@ -605,9 +627,20 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plNe &&
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
+    // If the reader indexed this array, loop only on the clusters that
+    // can be in the cone or in the UE bands, with their kinematics cached
+    Int_t nClusters = plNe->GetEntries();
+    Int_t slot      = reader->GetEtaPhiCellIndexSlot(plNe);
+    if ( slot >= 0 )
+    {
+      reader->GetEtaPhiCellIndexEntries(slot, etaC, phiC, fConeSize, fConeEntries);
+      nClusters = fConeEntries.size();
+    }
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    for(Int_t icl = 0; icl < nClusters ; icl ++ )
     {
+      Int_t ipr = ( slot >= 0 ) ? fConeEntries[icl] : icl;
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
@@ -629,12 +662,21 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
              pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
         }
         
-        // Assume that come from vertex in straight line
-        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-        
-        pt  = fMomentum.Pt()  ;
-        eta = fMomentum.Eta() ;
-        phi = fMomentum.Phi() ;
+        if ( slot >= 0 )
+        {
+          pt  = reader->GetEtaPhiCellIndexPt (slot,ipr);
+          eta = reader->GetEtaPhiCellIndexEta(slot,ipr);
+          phi = reader->GetEtaPhiCellIndexPhi(slot,ipr);
+        }
+        else
+        {
+          // Assume that come from vertex in straight line
+          calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+          
+          pt  = fMomentum.Pt()  ;
+          eta = fMomentum.Eta() ;
+          phi = fMomentum.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
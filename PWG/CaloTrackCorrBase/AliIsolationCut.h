@@ -22,6 +22,7 @@
 #include <TObject.h>
 class TObjArray ;
 #include <TLorentzVector.h>
+#include <vector>
 
 // --- ANALYSIS system ---
 class AliAODPWG4ParticleCorrelation ;
@@ -140,6 +141,8 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  std::vector<Int_t> fConeEntries; //!<! Entries of the tracks/clusters array near the candidate, from the reader eta-phi cell index, temporal container.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -85,6 +85,7 @@ ClassImp(AliNanoAODReplicator)
 AliNanoAODReplicator::AliNanoAODReplicator() :
 AliAODBranchReplicator(), 
   fTrackCut(0), fTracks(0x0), fHeader(0x0), fNTracksVariables(0), // FIXME: Start using cuts, and check if fNTracksVariables is needed
+  fTrackVarCodes(),
   fVertices(0x0), 
   fList(0x0),
   fMCParticles(0x0),
@@ -112,6 +113,7 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title,
   AliAODBranchReplicator(name,title), 
 
   fTrackCut(trackCut), fTracks(0x0), fHeader(0x0), fNTracksVariables(0), // FIXME: Start using cuts, and check if fNTracksVariables is needed
+  fTrackVarCodes(),
   fVertices(0x0), 
   fList(0x0),
   fMCParticles(0x0),
@@ -500,6 +502,12 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   const Int_t entries = source.GetNumberOfTracks();
   if(entries<=0) return;
 
+  // resolve the variable names only once (the mapping does not change), instead of for every track
+  if(fTrackVarCodes.GetSize() == 0) {
+    AliNanoAODTrackMapping::GetInstance(fVarList);
+    AliNanoAODTrack::GetVarCodes(fTrackVarCodes);
+  }
+
   for(Int_t j=0; j<entries; j++){
     
     AliVTrack *track = (AliVTrack*)source.GetTrack(j);
@@ -507,7 +515,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     AliAODTrack *aodtrack =(AliAODTrack*)track;// FIXME DYNAMIC CAST?
     if(fTrackCut && !fTrackCut->IsSelected(aodtrack)) continue;
 
-    AliNanoAODTrack * special = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
+    AliNanoAODTrack * special = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fTrackVarCodes);
 
     if(fCustomSetter) fCustomSetter->SetNanoAODTrack(aodtrack, special);
   }  
@@ -13,6 +13,9 @@
 #ifndef ROOT_TExMap
 #  include "TExMap.h"
 #endif
+#ifndef ROOT_TArrayI
+#  include "TArrayI.h"
+#endif
 
 #include <iostream>
 
@@ -35,7 +38,6 @@ class AliAODVZERO;
 class AliAODTZERO;
 class AliPIDResponse;
 class AliESDv0;
-class TArrayI;
 class AliAODv0;  
 class TRefArray;
 class AliAODRecoDecay;
@@ -114,6 +116,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   mutable TClonesArray* fTracks; //! internal array of arrays of NanoAOD tracks
   mutable AliNanoAODHeader* fHeader; //! internal array of headers
   Int_t fNTracksVariables; //! Number of variables in the array
+  TArrayI fTrackVarCodes; //! codes of the track variables, resolved once from the mapping
  
   mutable TClonesArray* fVertices; //! internal array of vertices
  
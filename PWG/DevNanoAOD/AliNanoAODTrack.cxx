@@ -30,9 +30,13 @@
 
 #include "AliNanoAODTrack.h"
 #include "AliNanoAODTrackMapping.h"
+#include "TClonesArray.h"
 
 ClassImp(AliNanoAODTrack)
 
+Int_t  AliNanoAODTrack::fgVarIndex[AliNanoAODTrack::kVarCovMat];
+Bool_t AliNanoAODTrack::fgVarIndexValid = kFALSE;
+
 
 //______________________________________________________________________________
 AliNanoAODTrack::AliNanoAODTrack() : 
@@ -67,63 +71,197 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
 {
   // constructor
 
-  Double_t position[3];
-  Bool_t isPosAvailable = !(aodTrack->GetXYZ(position)); // GetXYZ() returns kTRUE, if it's DCA information
   AliNanoAODTrackMapping::GetInstance(vars);
 
-  // Create internal structure
-  AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize());
+  TArrayI varCodes;
+  GetVarCodes(varCodes);
+  SetVarsFromAODTrack(aodTrack, varCodes);
 
-  for (Int_t index = 0; index<AliNanoAODTrackMapping::GetInstance()->GetSize(); index++) {
+}
+
+//______________________________________________________________________________
+AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const TArrayI & varCodes) :
+  AliVTrack(), 
+  AliNanoAODStorage(),
+  fLabel(0),
+  fProdVertex(0),
+  fCharge(0),
+  fAODEvent(NULL)
+{
+  // constructor
+  // Same as the constructor from the variable list, but the variables are
+  // identified by the codes resolved once with GetVarCodes() (the mapping
+  // must already exist), which avoids the string comparisons for every track
+
+  SetVarsFromAODTrack(aodTrack, varCodes);
+
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::GetVarCodes(TArrayI & varCodes)
+{
+  // Resolves the variable names of the current mapping into the codes used by
+  // SetVarsFromAODTrack (kVarNone for custom and unknown variables)
+
+  const Int_t size = AliNanoAODTrackMapping::GetInstance()->GetSize();
+  varCodes.Set(size);
+  varCodes.Reset(kVarNone);
+
+  for (Int_t index = 0; index<size; index++) {
     TString varString = AliNanoAODTrackMapping::GetInstance()->GetVarName(index);
 
-    if     (varString == "pt"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()               , aodTrack->Pt()                      );
-    else if(varString == "phi"                    ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()              , aodTrack->Phi()                     );
-    else if(varString == "theta"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()            , aodTrack->Theta()                   );
-    else if(varString == "chi2perNDF"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
-    else if(varString == "posx" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()             , position[0]                         );
-    else if(varString == "posy" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()             , position[1]                         );
-    else if(varString == "posz" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()             , position[2]                         );
-    else if(varString == "posDCAx"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()          , aodTrack->XAtDCA()                  );
-    else if(varString == "posDCAy"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()          , aodTrack->YAtDCA()                  );
-    else if(varString == "pDCAx"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()            , aodTrack->PxAtDCA()                 );
-    else if(varString == "pDCAy"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()            , aodTrack->PyAtDCA()                 );
-    else if(varString == "pDCAz"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()            , aodTrack->PzAtDCA()                 );
-    else if(varString == "RAtAbsorberEnd"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       );
-    else if(varString == "TPCncls"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()          , aodTrack->GetTPCNcls()              );
-    else if(varString == "id"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->Getid()               , aodTrack->GetID()                   );
-    else if(varString == "TPCnclsF"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF()         , aodTrack->GetTPCNclsF()             );
-    else if(varString == "TPCNCrossedRows"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows()  , aodTrack->GetTPCNCrossedRows()      );
-    else if(varString == "TrackPhiOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      );
-    else if(varString == "TrackEtaOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      );
-    else if(varString == "TrackPtOnEMCal"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       );
-    else if(varString == "ITSsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal()        , aodTrack->GetITSsignal()            );
-    else if(varString == "TPCsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal()        , aodTrack->GetTPCsignal()            );
-    else if(varString == "TPCsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() );
-    else if(varString == "TPCsignalN"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN()       , aodTrack->GetTPCsignalN()           );
-    else if(varString == "TPCmomentum"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          );
-    else if(varString == "TPCTgl"                 ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl()           , aodTrack->GetTPCTgl()               );
-    else if(varString == "TOFsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal()        , aodTrack->GetTOFsignal()            );
-    else if(varString == "integratedLength"       ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetintegratedLenght() , aodTrack->GetIntegratedLength()     );
-    else if(varString == "TOFsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() );
-    else if(varString == "HMPIDsignal"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          );
-    else if(varString == "HMPIDoccupancy"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       );
-    else if(varString == "TRDsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal()        , aodTrack->GetTRDsignal()            );
-    else if(varString == "TRDChi2"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2()          , aodTrack->GetTRDchi2()              );
-    else if(varString == "TRDnSlices"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    );  
-    else if(varString == "IsMuonTrack"             ) {
-        if (aodTrack->IsMuonTrack()) SetVar(AliNanoAODTrackMapping::GetInstance()->GetIsMuonTrack(), 1.);
-        else SetVar(AliNanoAODTrackMapping::GetInstance()->GetIsMuonTrack(), 0.);
+    if     (varString == "pt"                     ) varCodes[index] = kVarPt;
+    else if(varString == "phi"                    ) varCodes[index] = kVarPhi;
+    else if(varString == "theta"                  ) varCodes[index] = kVarTheta;
+    else if(varString == "chi2perNDF"             ) varCodes[index] = kVarChi2PerNDF;
+    else if(varString == "posx"                   ) varCodes[index] = kVarPosX;
+    else if(varString == "posy"                   ) varCodes[index] = kVarPosY;
+    else if(varString == "posz"                   ) varCodes[index] = kVarPosZ;
+    else if(varString == "posDCAx"                ) varCodes[index] = kVarPosDCAx;
+    else if(varString == "posDCAy"                ) varCodes[index] = kVarPosDCAy;
+    else if(varString == "pDCAx"                  ) varCodes[index] = kVarPDCAx;
+    else if(varString == "pDCAy"                  ) varCodes[index] = kVarPDCAy;
+    else if(varString == "pDCAz"                  ) varCodes[index] = kVarPDCAz;
+    else if(varString == "RAtAbsorberEnd"         ) varCodes[index] = kVarRAtAbsorberEnd;
+    else if(varString == "TPCncls"                ) varCodes[index] = kVarTPCncls;
+    else if(varString == "id"                     ) varCodes[index] = kVarID;
+    else if(varString == "TPCnclsF"               ) varCodes[index] = kVarTPCnclsF;
+    else if(varString == "TPCNCrossedRows"        ) varCodes[index] = kVarTPCNCrossedRows;
+    else if(varString == "TrackPhiOnEMCal"        ) varCodes[index] = kVarTrackPhiOnEMCal;
+    else if(varString == "TrackEtaOnEMCal"        ) varCodes[index] = kVarTrackEtaOnEMCal;
+    else if(varString == "TrackPtOnEMCal"         ) varCodes[index] = kVarTrackPtOnEMCal;
+    else if(varString == "ITSsignal"              ) varCodes[index] = kVarITSsignal;
+    else if(varString == "TPCsignal"              ) varCodes[index] = kVarTPCsignal;
+    else if(varString == "TPCsignalTuned"         ) varCodes[index] = kVarTPCsignalTuned;
+    else if(varString == "TPCsignalN"             ) varCodes[index] = kVarTPCsignalN;
+    else if(varString == "TPCmomentum"            ) varCodes[index] = kVarTPCmomentum;
+    else if(varString == "TPCTgl"                 ) varCodes[index] = kVarTPCTgl;
+    else if(varString == "TOFsignal"              ) varCodes[index] = kVarTOFsignal;
+    else if(varString == "integratedLength"       ) varCodes[index] = kVarIntegratedLength;
+    else if(varString == "TOFsignalTuned"         ) varCodes[index] = kVarTOFsignalTuned;
+    else if(varString == "HMPIDsignal"            ) varCodes[index] = kVarHMPIDsignal;
+    else if(varString == "HMPIDoccupancy"         ) varCodes[index] = kVarHMPIDoccupancy;
+    else if(varString == "TRDsignal"              ) varCodes[index] = kVarTRDsignal;
+    else if(varString == "TRDChi2"                ) varCodes[index] = kVarTRDChi2;
+    else if(varString == "TRDnSlices"             ) varCodes[index] = kVarTRDnSlices;
+    else if(varString == "IsMuonTrack"            ) varCodes[index] = kVarIsMuonTrack;
+    else if(varString == "TPCnclsS"               ) varCodes[index] = kVarTPCnclsS;
+    else if(varString == "FilterMap"              ) varCodes[index] = kVarFilterMap;
+    else if(varString == "covmat0"                ) {
+      varCodes[index] = kVarCovMat;
+      index+=20;
+    }
+  }
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::UpdateVarIndex()
+{
+  // Caches the positions of the standard variables in the current mapping, so that the
+  // accessors do not go through the mapping for every call (see GetVarIndex)
+
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  fgVarIndex[kVarPt]               = mapping->GetPt();
+  fgVarIndex[kVarPhi]              = mapping->GetPhi();
+  fgVarIndex[kVarTheta]            = mapping->GetTheta();
+  fgVarIndex[kVarChi2PerNDF]       = mapping->GetChi2PerNDF();
+  fgVarIndex[kVarPosX]             = mapping->GetPosX();
+  fgVarIndex[kVarPosY]             = mapping->GetPosY();
+  fgVarIndex[kVarPosZ]             = mapping->GetPosZ();
+  fgVarIndex[kVarPosDCAx]          = mapping->GetPosDCAx();
+  fgVarIndex[kVarPosDCAy]          = mapping->GetPosDCAy();
+  fgVarIndex[kVarPDCAx]            = mapping->GetPDCAX();
+  fgVarIndex[kVarPDCAy]            = mapping->GetPDCAY();
+  fgVarIndex[kVarPDCAz]            = mapping->GetPDCAZ();
+  fgVarIndex[kVarRAtAbsorberEnd]   = mapping->GetRAtAbsorberEnd();
+  fgVarIndex[kVarTPCncls]          = mapping->GetTPCncls();
+  fgVarIndex[kVarID]               = mapping->Getid();
+  fgVarIndex[kVarTPCnclsF]         = mapping->GetTPCnclsF();
+  fgVarIndex[kVarTPCNCrossedRows]  = mapping->GetTPCNCrossedRows();
+  fgVarIndex[kVarTrackPhiOnEMCal]  = mapping->GetTrackPhiOnEMCal();
+  fgVarIndex[kVarTrackEtaOnEMCal]  = mapping->GetTrackEtaOnEMCal();
+  fgVarIndex[kVarTrackPtOnEMCal]   = mapping->GetTrackPtOnEMCal();
+  fgVarIndex[kVarITSsignal]        = mapping->GetITSsignal();
+  fgVarIndex[kVarTPCsignal]        = mapping->GetTPCsignal();
+  fgVarIndex[kVarTPCsignalTuned]   = mapping->GetTPCsignalTuned();
+  fgVarIndex[kVarTPCsignalN]       = mapping->GetTPCsignalN();
+  fgVarIndex[kVarTPCmomentum]      = mapping->GetTPCmomentum();
+  fgVarIndex[kVarTPCTgl]           = mapping->GetTPCTgl();
+  fgVarIndex[kVarTOFsignal]        = mapping->GetTOFsignal();
+  fgVarIndex[kVarIntegratedLength] = mapping->GetintegratedLenght();
+  fgVarIndex[kVarTOFsignalTuned]   = mapping->GetTOFsignalTuned();
+  fgVarIndex[kVarHMPIDsignal]      = mapping->GetHMPIDsignal();
+  fgVarIndex[kVarHMPIDoccupancy]   = mapping->GetHMPIDoccupancy();
+  fgVarIndex[kVarTRDsignal]        = mapping->GetTRDsignal();
+  fgVarIndex[kVarTRDChi2]          = mapping->GetTRDChi2();
+  fgVarIndex[kVarTRDnSlices]       = mapping->GetTRDnSlices();
+  fgVarIndex[kVarIsMuonTrack]      = mapping->GetIsMuonTrack();
+  fgVarIndex[kVarTPCnclsS]         = mapping->GetTPCnclsS();
+  fgVarIndex[kVarFilterMap]        = mapping->GetFilterMap();
+  fgVarIndexValid = kTRUE;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::SetVarsFromAODTrack(AliAODTrack * aodTrack, const TArrayI & varCodes)
+{
+  // Copies the variables identified by varCodes from the AOD track
+
+  Double_t position[3];
+  Bool_t isPosAvailable = !(aodTrack->GetXYZ(position)); // GetXYZ() returns kTRUE, if it's DCA information
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+
+  // Create internal structure
+  AllocateInternalStorage(mapping->GetSize());
+
+  const Int_t size = varCodes.GetSize();
+  for (Int_t index = 0; index<size; index++) {
+    switch (varCodes[index]) {
+    case kVarPt                : SetVar(mapping->GetPt()               , aodTrack->Pt()                      ); break;
+    case kVarPhi               : SetVar(mapping->GetPhi()              , aodTrack->Phi()                     ); break;
+    case kVarTheta             : SetVar(mapping->GetTheta()            , aodTrack->Theta()                   ); break;
+    case kVarChi2PerNDF        : SetVar(mapping->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              ); break;
+    case kVarPosX              : if (isPosAvailable) SetVar(mapping->GetPosX(), position[0]                  ); break;
+    case kVarPosY              : if (isPosAvailable) SetVar(mapping->GetPosY(), position[1]                  ); break;
+    case kVarPosZ              : if (isPosAvailable) SetVar(mapping->GetPosZ(), position[2]                  ); break;
+    case kVarPosDCAx           : SetVar(mapping->GetPosDCAx()          , aodTrack->XAtDCA()                  ); break;
+    case kVarPosDCAy           : SetVar(mapping->GetPosDCAy()          , aodTrack->YAtDCA()                  ); break;
+    case kVarPDCAx             : SetVar(mapping->GetPDCAX()            , aodTrack->PxAtDCA()                 ); break;
+    case kVarPDCAy             : SetVar(mapping->GetPDCAY()            , aodTrack->PyAtDCA()                 ); break;
+    case kVarPDCAz             : SetVar(mapping->GetPDCAZ()            , aodTrack->PzAtDCA()                 ); break;
+    case kVarRAtAbsorberEnd    : SetVar(mapping->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       ); break;
+    case kVarTPCncls           : SetVar(mapping->GetTPCncls()          , aodTrack->GetTPCNcls()              ); break;
+    case kVarID                : SetVar(mapping->Getid()               , aodTrack->GetID()                   ); break;
+    case kVarTPCnclsF          : SetVar(mapping->GetTPCnclsF()         , aodTrack->GetTPCNclsF()             ); break;
+    case kVarTPCNCrossedRows   : SetVar(mapping->GetTPCNCrossedRows()  , aodTrack->GetTPCNCrossedRows()      ); break;
+    case kVarTrackPhiOnEMCal   : SetVar(mapping->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      ); break;
+    case kVarTrackEtaOnEMCal   : SetVar(mapping->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      ); break;
+    case kVarTrackPtOnEMCal    : SetVar(mapping->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       ); break;
+    case kVarITSsignal         : SetVar(mapping->GetITSsignal()        , aodTrack->GetITSsignal()            ); break;
+    case kVarTPCsignal         : SetVar(mapping->GetTPCsignal()        , aodTrack->GetTPCsignal()            ); break;
+    case kVarTPCsignalTuned    : SetVar(mapping->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() ); break;
+    case kVarTPCsignalN        : SetVar(mapping->GetTPCsignalN()       , aodTrack->GetTPCsignalN()           ); break;
+    case kVarTPCmomentum       : SetVar(mapping->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          ); break;
+    case kVarTPCTgl            : SetVar(mapping->GetTPCTgl()           , aodTrack->GetTPCTgl()               ); break;
+    case kVarTOFsignal         : SetVar(mapping->GetTOFsignal()        , aodTrack->GetTOFsignal()            ); break;
+    case kVarIntegratedLength  : SetVar(mapping->GetintegratedLenght() , aodTrack->GetIntegratedLength()     ); break;
+    case kVarTOFsignalTuned    : SetVar(mapping->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() ); break;
+    case kVarHMPIDsignal       : SetVar(mapping->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          ); break;
+    case kVarHMPIDoccupancy    : SetVar(mapping->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       ); break;
+    case kVarTRDsignal         : SetVar(mapping->GetTRDsignal()        , aodTrack->GetTRDsignal()            ); break;
+    case kVarTRDChi2           : SetVar(mapping->GetTRDChi2()          , aodTrack->GetTRDchi2()              ); break;
+    case kVarTRDnSlices        : SetVar(mapping->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    ); break;
+    case kVarIsMuonTrack       : SetVar(mapping->GetIsMuonTrack()      , aodTrack->IsMuonTrack() ? 1. : 0.   ); break;
+    case kVarTPCnclsS          : SetVar(mapping->GetTPCnclsS()         , aodTrack->GetTPCnclsS()             ); break;
+    case kVarFilterMap         : SetVar(mapping->GetFilterMap()        , aodTrack->GetFilterMap()            ); break;
+    case kVarCovMat            : {
+      Double_t covMatrix[21];
+      aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
+      for(Int_t i=0;i<21;i++){
+        SetVar(mapping->GetCovMat(i)       , covMatrix[i]                        );
+      }
+      break;
     }
-    else if(varString == "TPCnclsS"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS()         , aodTrack->GetTPCnclsS()             );
-    else if(varString == "FilterMap"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetFilterMap()        , aodTrack->GetFilterMap()            );
-    else if(varString == "covmat0"                 ) {
-        Double_t covMatrix[21];
-        Bool_t covmatrix = aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
-        for(Int_t i=0;i<21;i++){
-            SetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i)       , covMatrix[i]                        );
-        }
-        index+=20;
+    default : break;
     }
   }
 
@@ -138,6 +276,21 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
 
 }
 
+//______________________________________________________________________________
+void AliNanoAODTrack::GetVarColumn(const TClonesArray * tracks, Int_t varIndex, TArrayD & column)
+{
+  // Reads the variable varIndex of all the tracks in the array into column.
+  // The index is resolved by the caller once (e.g. from the mapping getters
+  // or GetVarIndex), so the loop needs neither the mapping nor virtual calls
+
+  const Int_t ntracks = tracks ? tracks->GetEntriesFast() : 0;
+  column.Set(ntracks);
+  for (Int_t itrack = 0; itrack<ntracks; itrack++) {
+    const AliNanoAODTrack * track = static_cast<const AliNanoAODTrack*>(tracks->UncheckedAt(itrack));
+    column[itrack] = track->GetVar(varIndex);
+  }
+}
+
 //______________________________________________________________________________
 AliNanoAODTrack::AliNanoAODTrack(AliESDTrack * /*esdTrack*/, const char * /*vars*/) : 
   AliVTrack(), 
@@ -345,18 +498,18 @@ template <typename T> void AliNanoAODTrack::SetP(const T *p, const Bool_t cartes
       Double_t pt2 = p[0]*p[0] + p[1]*p[1];
       Double_t pp  = TMath::Sqrt(pt2 + p[2]*p[2]);
         
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt() ,TMath::Sqrt(pt2)); // pt
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi() , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta() , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
+      SetVar(GetVarIndex(kVarPt) ,TMath::Sqrt(pt2)); // pt
+      SetVar(GetVarIndex(kVarPhi) , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
+      SetVar(GetVarIndex(kVarTheta) , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
     } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(GetVarIndex(kVarPt)      , p[0]);  
+      SetVar(GetVarIndex(kVarPhi)     , p[1]);  
+      SetVar(GetVarIndex(kVarTheta)   , p[2]);  
     }
   } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(GetVarIndex(kVarPt)      , p[0]);  
+      SetVar(GetVarIndex(kVarPhi)     , p[1]);  
+      SetVar(GetVarIndex(kVarTheta)   , p[2]);  
   }
 }
 
@@ -398,9 +551,9 @@ void AliNanoAODTrack::SetDCA(Double_t d, Double_t z)
   // where the same variable is used to store DCA or position,
   // according to the value of the bit kIsDCA. We can probably get rid
   // of this in the special track.
-  SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX(), d);
-  SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY(), z);
-  SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ(), 0);
+  SetVar(GetVarIndex(kVarPosX), d);
+  SetVar(GetVarIndex(kVarPosY), z);
+  SetVar(GetVarIndex(kVarPosZ), 0);
   SetBit(AliAODTrack::kIsDCA);
 }
 
@@ -432,7 +585,7 @@ Bool_t AliNanoAODTrack::PropagateToDCA(const AliVVertex *vtx,
   // return kFALSE is something went wrong
 
   // allowed only for tracks inside the beam pipe
-  Float_t xstart2 = GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())+GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY());
+  Float_t xstart2 = GetVar(GetVarIndex(kVarPosX))*GetVar(GetVarIndex(kVarPosX))+GetVar(GetVarIndex(kVarPosY))*GetVar(GetVarIndex(kVarPosY));
 
   if(xstart2 > 3.*3.) { // outside beampipe radius
     AliError("This method can be used only for propagation inside the beam pipe");
@@ -483,12 +636,12 @@ Bool_t AliNanoAODTrack::GetXYZAt(Double_t x, Double_t b, Double_t *r) const
   //maybe some of this code can be moved to AliVTrack to avoid code duplication
   const double kSafe = 1e-5;
   Double_t alpha=0.0;
-  Double_t radPos2 = GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())+GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY());
+  Double_t radPos2 = GetVar(GetVarIndex(kVarPosX))*GetVar(GetVarIndex(kVarPosX))+GetVar(GetVarIndex(kVarPosY))*GetVar(GetVarIndex(kVarPosY));
   Double_t radMax  = 45.; // approximately ITS outer radius
   if (radPos2 < radMax*radMax) { // inside the ITS     
     alpha = TMath::ATan2(Py(),Px());
   } else { // outside the ITS
-    Float_t phiPos = TMath::Pi()+TMath::ATan2(-GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()), -GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()));
+    Float_t phiPos = TMath::Pi()+TMath::ATan2(-GetVar(GetVarIndex(kVarPosY)), -GetVar(GetVarIndex(kVarPosX)));
      alpha = 
      TMath::DegToRad()*(20*((((Int_t)(phiPos*TMath::RadToDeg()))/20))+10);
   }
@@ -507,7 +660,7 @@ Bool_t AliNanoAODTrack::GetXYZAt(Double_t x, Double_t b, Double_t *r) const
   }
   
   // Get the vertex of origin and the momentum
-  TVector3 ver(GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()), GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()), GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()));
+  TVector3 ver(GetVar(GetVarIndex(kVarPosX)), GetVar(GetVarIndex(kVarPosY)), GetVar(GetVarIndex(kVarPosZ)));
   TVector3 mom(Px(),Py(),Pz());
   //
   // avoid momenta along axis
@@ -53,6 +53,8 @@
 #include "AliAODTrack.h"
 #include "TObjString.h"
 #include "TMap.h"
+#include "TArrayI.h"
+#include "TArrayD.h"
 #include "AliNanoAODTrackMapping.h"
 #include "AliNanoAODStorage.h"
 
@@ -65,15 +67,26 @@ class AliTPCdEdxInfo;
 class AliAODEvent;
 class AliAODTrack;
 class AliESDTrack;
+class TClonesArray;
 
 class AliNanoAODTrack : public AliVTrack, public AliNanoAODStorage {
 
 public:
   
   using TObject::ClassName;
+
+  // Codes of the standard variables, resolved from the mapping by GetVarCodes
+  enum { kVarNone = -1, kVarPt, kVarPhi, kVarTheta, kVarChi2PerNDF, kVarPosX, kVarPosY, kVarPosZ,
+	 kVarPosDCAx, kVarPosDCAy, kVarPDCAx, kVarPDCAy, kVarPDCAz, kVarRAtAbsorberEnd, kVarTPCncls,
+	 kVarID, kVarTPCnclsF, kVarTPCNCrossedRows, kVarTrackPhiOnEMCal, kVarTrackEtaOnEMCal,
+	 kVarTrackPtOnEMCal, kVarITSsignal, kVarTPCsignal, kVarTPCsignalTuned, kVarTPCsignalN,
+	 kVarTPCmomentum, kVarTPCTgl, kVarTOFsignal, kVarIntegratedLength, kVarTOFsignalTuned,
+	 kVarHMPIDsignal, kVarHMPIDoccupancy, kVarTRDsignal, kVarTRDChi2, kVarTRDnSlices,
+	 kVarIsMuonTrack, kVarTPCnclsS, kVarFilterMap, kVarCovMat };
   
   AliNanoAODTrack();
   AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars);
+  AliNanoAODTrack(AliAODTrack * aodTrack, const TArrayI & varCodes);
   AliNanoAODTrack(AliESDTrack * esdTrack, const char * vars);
   AliNanoAODTrack(const char * vars);
 
@@ -83,16 +96,21 @@ public:
 
 
   virtual void Clear(Option_t * opt) ;
+
+  static void GetVarCodes(TArrayI & varCodes); // one code per variable of the current mapping
+  static void GetVarColumn(const TClonesArray * tracks, Int_t varIndex, TArrayD & column); // variable varIndex of all tracks
+  static Int_t GetVarIndex(Int_t varCode) { if (!fgVarIndexValid) UpdateVarIndex(); return fgVarIndex[varCode]; } // position of a standard variable in the current mapping
+  static void ResetVarIndex() { fgVarIndexValid = kFALSE; } // to be called if the mapping is replaced
   
   // kinematics
   virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
-  virtual Double_t Phi()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi());   }
-  virtual Double_t Theta()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()); }
+  virtual Double_t Phi()       const { return GetVar(GetVarIndex(kVarPhi));   }
+  virtual Double_t Theta()     const { return GetVar(GetVarIndex(kVarTheta)); }
   
   virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
   virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
   virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
-  virtual Double_t Pt() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()); }
+  virtual Double_t Pt() const { return GetVar(GetVarIndex(kVarPt)); }
   virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
   virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
 
@@ -101,8 +119,8 @@ public:
   virtual Double_t Zv() const { return GetProdVertex() ? GetProdVertex()->GetZ() : -999.; }
   virtual Bool_t   XvYvZv(Double_t x[3]) const { x[0] = Xv(); x[1] = Yv(); x[2] = Zv(); return kTRUE; }
 
-  Double_t Chi2perNDF()  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()); }  
-  UShort_t GetTPCNcls()  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()); } // FIXME: should this be short?
+  Double_t Chi2perNDF()  const { return GetVar(GetVarIndex(kVarChi2PerNDF)); }  
+  UShort_t GetTPCNcls()  const { return GetVar(GetVarIndex(kVarTPCncls)); } // FIXME: should this be short?
 
   virtual Double_t M() const { AliFatal("Not Implemented"); return -1; }
   Double_t M(AliAODTrack::AODTrkPID_t pid) const;
@@ -151,7 +169,7 @@ public:
 
   
   template <typename T> Bool_t GetPosition(T *x) const {
-    x[0]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()); x[1]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()); x[2]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ());
+    x[0]=GetVar(GetVarIndex(kVarPosX)); x[1]=GetVar(GetVarIndex(kVarPosY)); x[2]=GetVar(GetVarIndex(kVarPosZ));
     return TestBit(AliAODTrack::kIsDCA);}
 
   // FIXME: only allocate if listed?
@@ -175,32 +193,32 @@ public:
   // void RemoveCovMatrix() {delete fCovMatrix; fCovMatrix=NULL;}
 
   Bool_t IsMuonTrack() const {
-  if (GetVar(AliNanoAODTrackMapping::GetInstance()->GetIsMuonTrack())==1) return kTRUE ; 
+  if (GetVar(GetVarIndex(kVarIsMuonTrack))==1) return kTRUE ; 
   else return kFALSE;
   } 
 
-  Double_t XAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()); }
-  Double_t YAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()); }
+  Double_t XAtDCA() const { return GetVar(GetVarIndex(kVarPosDCAx)); }
+  Double_t YAtDCA() const { return GetVar(GetVarIndex(kVarPosDCAy)); }
   Double_t ZAtDCA() const { 
-    if (IsMuonTrack())  return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ());
-    else if (TestBit(AliAODTrack::kIsDCA)) return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY());
+    if (IsMuonTrack())  return GetVar(GetVarIndex(kVarPosZ));
+    else if (TestBit(AliAODTrack::kIsDCA)) return GetVar(GetVarIndex(kVarPosY));
      else return -999.; }
 
   Bool_t   XYZAtDCA(Double_t x[3]) const { x[0] = XAtDCA(); x[1] = YAtDCA(); x[2] = ZAtDCA(); return kTRUE; }
   
   Double_t DCA() const { 
     if (IsMuonTrack()) return TMath::Sqrt(XAtDCA()*XAtDCA() + YAtDCA()*YAtDCA());
-    else if (TestBit(AliAODTrack::kIsDCA)) return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()); // FIXME: Why does this return posX?
+    else if (TestBit(AliAODTrack::kIsDCA)) return GetVar(GetVarIndex(kVarPosX)); // FIXME: Why does this return posX?
     else return -999.; }
 
   
-  Double_t PxAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()); }
-  Double_t PyAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()); }
-  Double_t PzAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()); }
+  Double_t PxAtDCA() const { return GetVar(GetVarIndex(kVarPDCAx)); }
+  Double_t PyAtDCA() const { return GetVar(GetVarIndex(kVarPDCAy)); }
+  Double_t PzAtDCA() const { return GetVar(GetVarIndex(kVarPDCAz)); }
   Double_t PAtDCA() const { return TMath::Sqrt(PxAtDCA()*PxAtDCA() + PyAtDCA()*PyAtDCA() + PzAtDCA()*PzAtDCA()); }
   Bool_t   PxPyPzAtDCA(Double_t p[3]) const { p[0] = PxAtDCA(); p[1] = PyAtDCA(); p[2] = PzAtDCA(); return kTRUE; }
   
-  Double_t GetRAtAbsorberEnd() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()); }
+  Double_t GetRAtAbsorberEnd() const { return GetVar(GetVarIndex(kVarRAtAbsorberEnd)); }
   
   // For this whole block of cluster maps I could simply define a cluster map in the int array. For the moment comment all maps. Maybe not neede 
   UChar_t  GetITSClusterMap() const       { AliFatal("Not Implemented"); return 0;};
@@ -210,7 +228,7 @@ public:
   // UInt_t   GetMUONClusterMap() const      { return (fITSMuonClusterMap&0x3ff0000)>>16; } // 
   // UInt_t   GetITSMUONClusterMap() const   { return fITSMuonClusterMap; }
   
-   Bool_t  TestFilterBit(UInt_t filterBit) const {return (Bool_t) ((filterBit & UInt_t(GetVar(AliNanoAODTrackMapping::GetInstance()->GetFilterMap()))) != 0);}
+   Bool_t  TestFilterBit(UInt_t filterBit) const {return (Bool_t) ((filterBit & UInt_t(GetVar(GetVarIndex(kVarFilterMap)))) != 0);}
   // Bool_t  TestFilterMask(UInt_t filterMask) const {return (Bool_t) ((filterMask & fFilterMap) == filterMask);}
   // void    SetFilterMap(UInt_t i){fFilterMap = i;}
   // UInt_t  GetFilterMap() const {return fFilterMap;}
@@ -228,12 +246,12 @@ public:
   // void    SetTPCSharedMap(const TBits amap) {fTPCSharedMap = amap;}
   // void    SetTPCFitMap(const TBits amap) {fTPCFitMap = amap;}
   // 
-  void    SetTPCPointsF(UShort_t  findable){fVars[AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF()] = findable;}
-  void    SetTPCNCrossedRows(UInt_t n)     {fVars[AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows()] = n;}
+  void    SetTPCPointsF(UShort_t  findable){fVars[GetVarIndex(kVarTPCnclsF)] = findable;}
+  void    SetTPCNCrossedRows(UInt_t n)     {fVars[GetVarIndex(kVarTPCNCrossedRows)] = n;}
 
-  UShort_t GetTPCNclsF() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF());}
-  UShort_t GetTPCnclsS() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS());}
-  UShort_t GetTPCNCrossedRows()  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows());}
+  UShort_t GetTPCNclsF() const { return GetVar(GetVarIndex(kVarTPCnclsF));}
+  UShort_t GetTPCnclsS() const { return GetVar(GetVarIndex(kVarTPCnclsS));}
+  UShort_t GetTPCNCrossedRows()  const { return GetVar(GetVarIndex(kVarTPCNCrossedRows));}
   Float_t  GetTPCFoundFraction() const { return GetTPCNCrossedRows()>0 ? float(GetTPCNcls())/GetTPCNCrossedRows() : 0;}
 
   // Calorimeter Cluster
@@ -242,11 +260,11 @@ public:
   // void SetEMCALcluster(Int_t index) {fCaloIndex=index;}
   // Bool_t IsEMCAL() const {return fFlags&kEMCALmatch;}
 
-  Double_t GetTrackPhiOnEMCal() const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal());}
-  Double_t GetTrackEtaOnEMCal() const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal());}
-  Double_t GetTrackPtOnEMCal() const  {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal());}
+  Double_t GetTrackPhiOnEMCal() const {return GetVar(GetVarIndex(kVarTrackPhiOnEMCal));}
+  Double_t GetTrackEtaOnEMCal() const {return GetVar(GetVarIndex(kVarTrackEtaOnEMCal));}
+  Double_t GetTrackPtOnEMCal() const  {return GetVar(GetVarIndex(kVarTrackPtOnEMCal));}
   Double_t GetTrackPOnEMCal() const {return TMath::Abs(GetTrackEtaOnEMCal()) < 1 ? GetTrackPtOnEMCal()*TMath::CosH(GetTrackEtaOnEMCal()) : -999;}
-  void SetTrackPhiEtaPtOnEMCal(Double_t phi,Double_t eta,Double_t pt) {fVars[AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal()]=phi;fVars[AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal()]=eta;fVars[AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal()]=pt;}
+  void SetTrackPhiEtaPtOnEMCal(Double_t phi,Double_t eta,Double_t pt) {fVars[GetVarIndex(kVarTrackPhiOnEMCal)]=phi;fVars[GetVarIndex(kVarTrackEtaOnEMCal)]=eta;fVars[GetVarIndex(kVarTrackPtOnEMCal)]=pt;}
 
   //  Int_t GetPHOScluster() const {return fCaloIndex;} // TODO: int array
   //  void SetPHOScluster(Int_t index) {fCaloIndex=index;}
@@ -254,21 +272,21 @@ public:
 
   //pid signal interface
   //TODO you can remove the PID object
-  Double_t  GetITSsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal());}
-  Double_t  GetTPCsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal());}
-  Double_t  GetTPCsignalTunedOnData() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned());}
-  void      SetTPCsignalTunedOnData(Double_t signal) {fVars[AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned()] = signal;}
-  UShort_t  GetTPCsignalN()      const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN());}// FIXME: what is this?
+  Double_t  GetITSsignal()       const { return GetVar(GetVarIndex(kVarITSsignal));}
+  Double_t  GetTPCsignal()       const { return GetVar(GetVarIndex(kVarTPCsignal));}
+  Double_t  GetTPCsignalTunedOnData() const { return GetVar(GetVarIndex(kVarTPCsignalTuned));}
+  void      SetTPCsignalTunedOnData(Double_t signal) {fVars[GetVarIndex(kVarTPCsignalTuned)] = signal;}
+  UShort_t  GetTPCsignalN()      const { return GetVar(GetVarIndex(kVarTPCsignalN));}// FIXME: what is this?
   //  virtual AliTPCdEdxInfo* GetTPCdEdxInfo() const {return fDetPid?fDetPid->GetTPCdEdxInfo():0;} // FIXME: is this needed?
-  Double_t  GetTPCmomentum()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()); }
-  Double_t  GetTPCTgl()          const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl());      } // FIXME: what is this?
-  Double_t  GetTOFsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal());   } 
+  Double_t  GetTPCmomentum()     const { return GetVar(GetVarIndex(kVarTPCmomentum)); }
+  Double_t  GetTPCTgl()          const { return GetVar(GetVarIndex(kVarTPCTgl));      } // FIXME: what is this?
+  Double_t  GetTOFsignal()       const { return GetVar(GetVarIndex(kVarTOFsignal));   } 
   Double_t  GetIntegratedLength() const { AliFatal("Not implemented"); return 0;} // TODO: implement track lenght
   void      SetIntegratedLength(Double_t/* l*/) {AliFatal("Not implemented");}
-  Double_t  GetTOFsignalTunedOnData() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned());}
-  void      SetTOFsignalTunedOnData(Double_t signal) {fVars[AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned()] = signal;}
-  Double_t  GetHMPIDsignal()      const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal());}; 
-  Double_t  GetHMPIDoccupancy()  const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy());}; 
+  Double_t  GetTOFsignalTunedOnData() const { return GetVar(GetVarIndex(kVarTOFsignalTuned));}
+  void      SetTOFsignalTunedOnData(Double_t signal) {fVars[GetVarIndex(kVarTOFsignalTuned)] = signal;}
+  Double_t  GetHMPIDsignal()      const {return GetVar(GetVarIndex(kVarHMPIDsignal));}; 
+  Double_t  GetHMPIDoccupancy()  const {return GetVar(GetVarIndex(kVarHMPIDoccupancy));}; 
   
       
   
@@ -288,10 +306,10 @@ public:
   Double_t  GetTRDmomentum(Int_t /*plane*/, Double_t */*sp*/=0x0) const {AliFatal("Not Implemented"); return 0;};
   // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 
-  Double_t  GetTRDsignal()         const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal());}
-  Double_t  GetTRDchi2()           const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2());}
+  Double_t  GetTRDsignal()         const {return GetVar(GetVarIndex(kVarTRDsignal));}
+  Double_t  GetTRDchi2()           const {return GetVar(GetVarIndex(kVarTRDChi2));}
   UChar_t   GetTRDncls()           const {return GetTRDncls(-1);}
-  Int_t     GetNumberOfTRDslices() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()); }
+  Int_t     GetNumberOfTRDslices() const { return GetVar(GetVarIndex(kVarTRDnSlices)); }
 
   const AliAODEvent* GetAODEvent() const {return fAODEvent;}// FIXME: change to special event type
   void SetAODEvent(const AliAODEvent* ptr){fAODEvent = ptr;}
@@ -324,20 +342,20 @@ public:
 
 
 
-  void SetOneOverPt(Double_t oneOverPt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = 1. / oneOverPt; }
-  void SetPt(Double_t pt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = pt; };
-  void SetPhi(Double_t phi) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPhi()] = phi; }
-  void SetTheta(Double_t theta) { fVars[AliNanoAODTrackMapping::GetInstance()->GetTheta()] = theta; }
+  void SetOneOverPt(Double_t oneOverPt) { fVars[GetVarIndex(kVarPt)] = 1. / oneOverPt; }
+  void SetPt(Double_t pt) { fVars[GetVarIndex(kVarPt)] = pt; };
+  void SetPhi(Double_t phi) { fVars[GetVarIndex(kVarPhi)] = phi; }
+  void SetTheta(Double_t theta) { fVars[GetVarIndex(kVarTheta)] = theta; }
   template <typename T> void SetP(const T *p, Bool_t cartesian = kTRUE);// TODO: WHAT IS THIS FOR?
   void SetP() {AliFatal("Not Implemented");}
 
-  void SetXYAtDCA(Double_t x, Double_t y) {fVars[AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()] = x;  fVars[AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()]= y;}
-  void SetPxPyPzAtDCA(Double_t pX, Double_t pY, Double_t pZ) {fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAX()] = pX; fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAY()] = pY; fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()] = pZ;}
+  void SetXYAtDCA(Double_t x, Double_t y) {fVars[GetVarIndex(kVarPosDCAx)] = x;  fVars[GetVarIndex(kVarPosDCAy)]= y;}
+  void SetPxPyPzAtDCA(Double_t pX, Double_t pY, Double_t pZ) {fVars[GetVarIndex(kVarPDCAx)] = pX; fVars[GetVarIndex(kVarPDCAy)] = pY; fVars[GetVarIndex(kVarPDCAz)] = pZ;}
   
-void SetRAtAbsorberEnd(Double_t r) { fVars[AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()] = r; }
+void SetRAtAbsorberEnd(Double_t r) { fVars[GetVarIndex(kVarRAtAbsorberEnd)] = r; }
   
   void SetCharge(Short_t q) { fCharge = q; }
-void SetChi2perNDF(Double_t chi2perNDF) { fVars[AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()] = chi2perNDF; }
+void SetChi2perNDF(Double_t chi2perNDF) { fVars[GetVarIndex(kVarChi2PerNDF)] = chi2perNDF; }
 
   // void SetITSClusterMap(UChar_t itsClusMap)                 { fITSMuonClusterMap = (fITSMuonClusterMap&0xffffff00)|(((UInt_t)itsClusMap)&0xff); }
   // void SetHitsPatternInTrigCh(UShort_t hitsPatternInTrigCh) { fITSMuonClusterMap = (fITSMuonClusterMap&0xffff00ff)|((((UInt_t)hitsPatternInTrigCh)&0xff)<<8); }
@@ -373,6 +391,7 @@ void SetChi2perNDF(Double_t chi2perNDF) { fVars[AliNanoAODTrackMapping::GetInsta
 
 private :
 
+  void SetVarsFromAODTrack(AliAODTrack * aodTrack, const TArrayI & varCodes);
 
 
   // Momentum & position
@@ -383,6 +402,11 @@ private :
   Short_t       fCharge; // track charge
   const AliAODEvent* fAODEvent;     //! 
 
+  static void UpdateVarIndex();
+
+  static Int_t  fgVarIndex[kVarCovMat]; // cached positions of the standard variables in the mapping (see GetVarIndex)
+  static Bool_t fgVarIndexValid;        // flag if fgVarIndex corresponds to the current mapping
+
   ClassDef(AliNanoAODTrack, 1);
 };
 
@@ -417,22 +441,22 @@ void AliNanoAODTrack::SetPosition(const T *x, const Bool_t dca)
     if (!dca) {
       ResetBit(AliAODTrack::kIsDCA);
 
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosX()] = x[0];
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosY()] = x[1];
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosZ()] = x[2];
+      fVars[GetVarIndex(kVarPosX)] = x[0];
+      fVars[GetVarIndex(kVarPosY)] = x[1];
+      fVars[GetVarIndex(kVarPosZ)] = x[2];
     } else {
       SetBit(AliAODTrack::kIsDCA);
       // don't know any better yet
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosX()] = -999.;
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosY()] = -999.;
-      fVars[AliNanoAODTrackMapping::GetInstance()->GetPosZ()] = -999.;
+      fVars[GetVarIndex(kVarPosX)] = -999.;
+      fVars[GetVarIndex(kVarPosY)] = -999.;
+      fVars[GetVarIndex(kVarPosZ)] = -999.;
     }
   } else {
     ResetBit(AliAODTrack::kIsDCA);
 
-    fVars[AliNanoAODTrackMapping::GetInstance()->GetPosX()] = -999.;
-    fVars[AliNanoAODTrackMapping::GetInstance()->GetPosY()] = -999.;
-    fVars[AliNanoAODTrackMapping::GetInstance()->GetPosZ()] = -999.;
+    fVars[GetVarIndex(kVarPosX)] = -999.;
+    fVars[GetVarIndex(kVarPosY)] = -999.;
+    fVars[GetVarIndex(kVarPosZ)] = -999.;
   }
 }
 
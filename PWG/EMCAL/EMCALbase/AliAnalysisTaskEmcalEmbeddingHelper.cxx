@@ -26,6 +26,7 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TBranch.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -34,6 +35,7 @@
 #include <TProfile.h>
 #include <TH1F.h>
 #include <TRandom3.h>
+#include <TStopwatch.h>
 
 #include <AliLog.h>
 #include <AliAnalysisManager.h>
@@ -79,6 +81,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fPreselectWithEventBranches(true),
+  fTreeCacheSize(0),
 
   fFilePattern(""),
   fInputFilename(""),
@@ -94,6 +98,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fSelectionBranches(),
+  fFullEntryLoaded(false),
   fHistManager(),
   fOutput(nullptr),
 
@@ -139,6 +145,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fPreselectWithEventBranches(true),
+  fTreeCacheSize(0),
   
   fFilePattern(""),
   fInputFilename(""),
@@ -154,6 +162,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fSelectionBranches(),
+  fFullEntryLoaded(false),
   fHistManager(name),
   fOutput(nullptr),
   fExternalEvent(nullptr),
@@ -416,6 +426,10 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
  * next tree within the TChain. In the case of running of out files to embed, an error is thrown and embedding
  * begins again from the start of the file list.
  *
+ * NOTE: The events are read synchronously in the event loop, and no event is read in advance. Only the
+ *       cost of rejected events is reduced, by reading just the selection branches for them
+ *       (see SetPreselectWithEventBranches()).
+ *
  * @return kTRUE if successful
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
@@ -446,7 +460,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
     // Load current event
     // Can be a simple less than, because fFileNumber counts from 0.
     if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
+      LoadEntryForSelection(fCurrentEntry);
     }
     else {
       AliError("====================================================================================================");
@@ -464,7 +478,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
       // Access the relevant entry
       // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+      LoadEntryForSelection(fCurrentEntry);
     }
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
@@ -486,6 +500,14 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
   } while (!IsEventSelected());
 
+  // Only the branches needed for the selection were read, so read the rest of the accepted event.
+  // The properties are set again so that they point to the objects of the complete event.
+  if (!fFullEntryLoaded) {
+    fChain->GetEntry(fCurrentEntry - 1);
+    fFullEntryLoaded = true;
+    SetEmbeddedEventProperties();
+  }
+
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
     fHistManager.FillTH1("fHistEmbeddedEventsAttempted", attempts);
@@ -496,6 +518,40 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
   return kTRUE;
 }
 
+/**
+ * Load an entry of the TChain such that the embedded event selection can be applied. If preselection is enabled
+ * (see SetPreselectWithEventBranches()), only the branches in fSelectionBranches are read, which avoids reading
+ * and decompressing the tracks, clusters, etc. of events which are rejected anyway. Otherwise (or if one of the
+ * branches is not available in the current tree), the full entry is read.
+ *
+ * @param entry Entry in the TChain to load
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::LoadEntryForSelection(Long64_t entry)
+{
+  fFullEntryLoaded = false;
+  if (fSelectionBranches.size() > 0) {
+    Long64_t localEntry = fChain->LoadTree(entry);
+    TTree * tree = fChain->GetTree();
+    if (localEntry >= 0 && tree) {
+      std::vector <TBranch *> branches;
+      for (auto name : fSelectionBranches) {
+        TBranch * branch = tree->GetBranch(name.c_str());
+        if (!branch) break;
+        branches.push_back(branch);
+      }
+      if (branches.size() == fSelectionBranches.size()) {
+        for (auto branch : branches) {
+          branch->GetEntry(localEntry);
+        }
+        return;
+      }
+    }
+  }
+
+  fChain->GetEntry(entry);
+  fFullEntryLoaded = true;
+}
+
 /**
  * Set some properties of the event that are not immediately available from the external event to make them
  * available to user tasks.
@@ -690,6 +746,33 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::InitEvent()
 
   fExternalEvent->ReadFromTree(fChain, fTreeName);
 
+  // The embedded event selection only needs the header, the vertices and (for MC) the MC header.
+  // It is not applied in advance for ESDs, since the ESD vertices are spread over several branches.
+  fSelectionBranches.clear();
+  if (fPreselectWithEventBranches && dynamic_cast<AliAODEvent*>(fExternalEvent)) {
+    fSelectionBranches.push_back("header");
+    fSelectionBranches.push_back("vertices");
+    if (fExternalEvent->FindListObject(AliAODMCHeader::StdBranchName())) {
+      fSelectionBranches.push_back(AliAODMCHeader::StdBranchName());
+    }
+  }
+
+  // The cache prefetches its branches for all entries of a cluster. With the preselection, only the selection
+  // branches are cached, so the remaining branches are not read for rejected events. They are read directly
+  // for the accepted events. The learning phase is stopped so that these reads do not add them to the cache.
+  if (fTreeCacheSize > 0) {
+    fChain->SetCacheSize(fTreeCacheSize);
+    if (fSelectionBranches.size() > 0) {
+      for (auto name : fSelectionBranches) {
+        fChain->AddBranchToCache(name.c_str(), kTRUE);
+      }
+    }
+    else {
+      fChain->AddBranchToCache("*", kTRUE);
+    }
+    fChain->StopCacheLearningPhase();
+  }
+
   return kTRUE;
 }
 
@@ -763,6 +846,11 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserCreateOutputObjects()
   histTitle = "Number of times each absolute file number was embedded";
   fHistManager.CreateTH1(histName, histTitle, fMaxNumberOfFiles, 0, fMaxNumberOfFiles);
 
+  // Time spent to provide the next embedded event
+  histName = "fHistGetNextEntryTime";
+  histTitle = "Time to get the next embedded event;Real time (ms);Counts";
+  fHistManager.CreateTH1(histName, histTitle, 500, 0, 1000);
+
   // Add all histograms to output list
   TIter next(fHistManager.GetListOfHistograms());
   TObject* obj = 0;
@@ -1133,12 +1221,21 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserExec(Option_t*)
     SetupEmbedding();
   }
 
+  TStopwatch timer;
+  timer.Start();
+
   if (!fInitializedNewFile) {
     InitTree();
   }
 
   Bool_t res = GetNextEntry();
 
+  timer.Stop();
+  if (fCreateHisto) {
+    // Includes the opening of new files and the reading of rejected events
+    fHistManager.FillTH1("fHistGetNextEntryTime", timer.RealTime() * 1000.);
+  }
+
   if (!res) {
     AliError("Unable to get the event to embed. Nothing will be embedded.");
     return;
@@ -1237,6 +1334,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
+  tempSS << "Preselect with event branches: " << fPreselectWithEventBranches << "\n";
+  tempSS << "Tree cache size: " << fTreeCacheSize << "\n";
   tempSS << "Number of files to embed: " << fFilenames.size() << "\n";
 
   std::bitset<32> triggerMask(fTriggerMask);
@@ -97,6 +97,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
   bool GetCreateHistos()                                    const { return fCreateHisto; }
+  bool GetPreselectWithEventBranches()                      const { return fPreselectWithEventBranches; }
+  Long64_t GetTreeCacheSize()                               const { return fTreeCacheSize; }
 
   // Set
   /// Set the pt hard bin which will be added into the file pattern. Can also be omitted and set directly in the pattern.
@@ -129,6 +131,17 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetFileListFilename(const char * filename)                 { fFileListFilename = filename; }
   /// Create QA histograms. These are necessary for proper scaling, so be careful disabling them!
   void SetCreateHistos(bool b)                                    { fCreateHisto = b; }
+  /**
+   * Apply the embedded event selection after reading only the branches that it needs (header, vertices and
+   * MC header of AODs). The remaining branches are only read for accepted events.
+   */
+  void SetPreselectWithEventBranches(bool b)                      { fPreselectWithEventBranches = b; }
+  /**
+   * Set the size (in bytes) of the TTreeCache of the external chain, so the baskets are fetched in large blocks
+   * from (remote) storage. With the preselection, only the branches needed for the event selection are cached.
+   * Otherwise all branches are cached. A value <= 0 keeps the ROOT default.
+   */
+  void SetTreeCacheSize(Long64_t size)                            { fTreeCacheSize = size; }
   /* @} */
 
   /**
@@ -193,6 +206,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          SetupInputFiles()     ;
   std::string     DeterminePythiaXSecFilename(TString baseFileName, TString pythiaBaseFilename, bool testIfExists);
   Bool_t          GetNextEntry()        ;
+  void            LoadEntryForSelection(Long64_t entry);
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
   Bool_t          IsEventSelected()     ;
@@ -219,6 +233,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t                                        fRandomEventNumberAccess; ///<  If true, it will start embedding from a random entry in the file rather than from the first
   Bool_t                                        fRandomFileAccess ; ///< If true, it will start embedding from a random file in the input files list
   bool                                          fCreateHisto      ; ///< If true, create QA histograms
+  bool                                          fPreselectWithEventBranches; ///< If true, read only the branches needed by the event selection before reading the full event
+  Long64_t                                      fTreeCacheSize    ; ///< Size of the TTreeCache of the external chain (<= 0: ROOT default)
 
   TString                                       fFilePattern      ; ///<  File pattern to select AliEn files using alien_find
   TString                                       fInputFilename    ; ///<  Filename of input root files
@@ -234,6 +250,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fOffset           ; //!<! Offset from fLowerEntry where the loop over the tree should start
   UInt_t                                        fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   UInt_t                                        fFileNumber       ; //!<! File number corresponding to the current tree
+  std::vector <std::string>                     fSelectionBranches; //!<! Branches read to apply the event selection (empty: read the full event)
+  bool                                          fFullEntryLoaded  ; //!<! Notes whether the last loaded entry was read completely
   THistManager                                  fHistManager      ; ///< Manages access to all histograms
   AliEmcalList                                 *fOutput           ; //!<! List which owns the output histograms to be saved
   AliVEvent                                    *fExternalEvent    ; //!<! Current external event available for embedding
@@ -253,7 +271,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 6);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 7);
   /// \endcond
 };
 #endif
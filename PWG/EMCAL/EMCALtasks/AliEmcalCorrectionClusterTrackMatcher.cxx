@@ -3,8 +3,12 @@
 
 #include "AliEmcalCorrectionClusterTrackMatcher.h"
 
+#include <algorithm>
+
 #include <TH1.h>
 #include <TList.h>
+#include <TVector2.h>
+#include <TVector3.h>
 
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
@@ -43,6 +47,16 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterEta(),
+  fClusterPhi(),
+  fClusterCellHead(),
+  fClusterCellNext(),
+  fMatchCandidates(),
+  fNClusterCellsEta(1),
+  fNClusterCellsPhi(1),
+  fClusterCellEtaMin(0),
+  fClusterCellEtaWidth(1),
+  fClusterCellPhiWidth(TMath::TwoPi()),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0),
   fNMCGenerToAccept(0),
@@ -362,24 +376,98 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
   }
 }
 
+/**
+ * Index the emcal clusters of the current event on an (eta, phi) grid.
+ * The cluster positions are converted to eta and phi once per event and the cells are at least
+ * fMaxDistance wide, so a track can only be matched to clusters in the 3x3 cells around it.
+ * Positions outside the eta range of the grid are clamped to the border cells, phi is periodic.
+ */
+void AliEmcalCorrectionClusterTrackMatcher::BuildClusterIndex()
+{
+  fClusterEta.resize(fNEmcalClusters);
+  fClusterPhi.resize(fNEmcalClusters);
+
+  Double_t etaMin = 0;
+  Double_t etaMax = 0;
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    Float_t pos[3] = {0};
+    emcalCluster->GetCluster()->GetPosition(pos);
+    TVector3 cpos(pos);
+    fClusterEta[icluster] = cpos.Eta();
+    fClusterPhi[icluster] = cpos.Phi();
+    if (icluster == 0 || fClusterEta[icluster] < etaMin) etaMin = fClusterEta[icluster];
+    if (icluster == 0 || fClusterEta[icluster] > etaMax) etaMax = fClusterEta[icluster];
+  }
+
+  const Int_t kMaxCells = 200;
+  fNClusterCellsEta = 1;
+  fNClusterCellsPhi = 1;
+  fClusterCellEtaMin = etaMin;
+  fClusterCellEtaWidth = etaMax - etaMin + 1;
+  fClusterCellPhiWidth = TMath::TwoPi();
+  if (fMaxDistance > 0) {
+    // small margin so that rounding cannot push a pair within fMaxDistance two cells apart
+    Double_t width = fMaxDistance * (1 + 1e-9);
+    fNClusterCellsEta = TMath::Min(kMaxCells, Int_t((etaMax - etaMin) / width) + 1);
+    fClusterCellEtaWidth = TMath::Max(width, (etaMax - etaMin) / fNClusterCellsEta);
+    fNClusterCellsPhi = TMath::Max(1, TMath::Min(kMaxCells, Int_t(TMath::TwoPi() / width)));
+    fClusterCellPhiWidth = TMath::TwoPi() / fNClusterCellsPhi;
+  }
+
+  fClusterCellHead.assign(fNClusterCellsEta * fNClusterCellsPhi, -1);
+  fClusterCellNext.resize(fNEmcalClusters);
+  for (Int_t icluster = fNEmcalClusters - 1; icluster >= 0; icluster--) {
+    Int_t ieta = TMath::Max(0, TMath::Min(fNClusterCellsEta - 1, Int_t(TMath::Floor((fClusterEta[icluster] - fClusterCellEtaMin) / fClusterCellEtaWidth))));
+    Int_t iphi = TMath::Max(0, TMath::Min(fNClusterCellsPhi - 1, Int_t(TMath::Floor((fClusterPhi[icluster] + TMath::Pi()) / fClusterCellPhiWidth))));
+    Int_t cell = ieta * fNClusterCellsPhi + iphi;
+    fClusterCellNext[icluster] = fClusterCellHead[cell];
+    fClusterCellHead[cell] = icluster;
+  }
+}
+
 /**
  * Set the links between tracks and clusters.
+ * Each track is only compared with the clusters in the neighbouring cells of the cluster index.
+ * The candidates are visited in the order of fEmcalClusters, so the matched lists are the same
+ * as with a comparison against all clusters.
  */
 void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  BuildClusterIndex();
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    Double_t veta = track->GetTrackEtaOnEMCal();
+    Double_t vphi = track->GetTrackPhiOnEMCal();
+
+    Int_t ieta = TMath::Max(0, TMath::Min(fNClusterCellsEta - 1, Int_t(TMath::Floor((veta - fClusterCellEtaMin) / fClusterCellEtaWidth))));
+    Int_t iphi = TMath::Max(0, TMath::Min(fNClusterCellsPhi - 1, Int_t(TMath::Floor((TVector2::Phi_mpi_pi(vphi) + TMath::Pi()) / fClusterCellPhiWidth))));
+    Int_t nphi = TMath::Min(3, fNClusterCellsPhi);
+
+    fMatchCandidates.clear();
+    for (Int_t jeta = TMath::Max(0, ieta - 1); jeta <= TMath::Min(fNClusterCellsEta - 1, ieta + 1); jeta++) {
+      for (Int_t k = 0; k < nphi; k++) {
+        Int_t jphi = (nphi < 3) ? k : (iphi + k - 1 + fNClusterCellsPhi) % fNClusterCellsPhi;
+        for (Int_t icluster = fClusterCellHead[jeta * fNClusterCellsPhi + jphi]; icluster >= 0; icluster = fClusterCellNext[icluster]) {
+          fMatchCandidates.push_back(icluster);
+        }
+      }
+    }
+    std::sort(fMatchCandidates.begin(), fMatchCandidates.end());
+
+    for (UInt_t icand = 0; icand < fMatchCandidates.size(); icand++) {
+      Int_t icluster = fMatchCandidates[icand];
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
-      Double_t deta = 999;
-      Double_t dphi = 999;
-      GetEtaPhiDiff(track, cluster, dphi, deta);
+      // same as GetEtaPhiDiff, with the cluster eta and phi cached in BuildClusterIndex
+      Double_t deta = veta - fClusterEta[icluster];
+      Double_t dphi = TVector2::Phi_mpi_pi(vphi - fClusterPhi[icluster]);
       Double_t d2 = deta * deta + dphi * dphi;
 
       if (d2 > maxd2) continue;
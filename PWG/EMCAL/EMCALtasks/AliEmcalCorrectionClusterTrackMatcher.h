@@ -1,6 +1,8 @@
 #ifndef ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 #define ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 
+#include <vector>
+
 #include "AliEmcalCorrectionComponent.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -69,6 +71,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Int_t         GetMomBin(Double_t p) const;
   void          GenerateEmcalParticles();
   void          DoMatching();
+  void          BuildClusterIndex();
   void          UpdateTracks();
   void          UpdateClusters();
   Bool_t        IsTrackInEmcalAcceptance(AliVParticle* part, Double_t edges=0.9) const;
@@ -98,6 +101,16 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   TClonesArray *fEmcalClusters;         //!<!emcal clusters
   Int_t         fNEmcalTracks;          //!<!number of emcal tracks
   Int_t         fNEmcalClusters;        //!<!number of emcal clusters
+  std::vector<Double_t> fClusterEta;    //!<!eta of the emcal clusters (same order as fEmcalClusters)
+  std::vector<Double_t> fClusterPhi;    //!<!phi of the emcal clusters (same order as fEmcalClusters)
+  std::vector<Int_t> fClusterCellHead;  //!<!first emcal cluster in each (eta, phi) cell
+  std::vector<Int_t> fClusterCellNext;  //!<!next emcal cluster in the same (eta, phi) cell
+  std::vector<Int_t> fMatchCandidates;  //!<!emcal clusters in the cells around a track
+  Int_t         fNClusterCellsEta;      //!<!number of eta cells of the cluster index
+  Int_t         fNClusterCellsPhi;      //!<!number of phi cells of the cluster index
+  Double_t      fClusterCellEtaMin;     //!<!lower eta edge of the cluster index
+  Double_t      fClusterCellEtaWidth;   //!<!eta width of a cell of the cluster index
+  Double_t      fClusterCellPhiWidth;   //!<!phi width of a cell of the cluster index
   TH1          *fHistMatchEtaAll;       //!<!deta distribution
   TH1          *fHistMatchPhiAll;       //!<!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!<!deta distribution
@@ -12,6 +12,7 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstring>
@@ -72,7 +73,11 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
-  fADCtoGeV(1.)
+  fADCtoGeV(1.),
+  fBadChannelMask(),
+  fOfflineBadChannelMask(),
+  fBadChannelMasksValid(kFALSE),
+  fSmearedEnergySums()
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
@@ -295,10 +300,12 @@ void AliEmcalTriggerMakerKernel::Reset(){
   fLevel0TimeMap->Reset();
   fTriggerBitMap->Reset();
   if(fPatchEnergySimpleSmeared) fPatchEnergySimpleSmeared->Reset();
+  fSmearedEnergySums.clear();
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
 }
 
 void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
+  UpdateBadChannelMasks();
   trigger->Reset();
   Int_t globCol=-1, globRow=-1;
   Int_t adcAmp=-1, bitmap = 0;
@@ -341,7 +348,7 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
     }
 
     // exclude channel completely if it is masked as hot channel
-    if (fBadChannels.find(absId) != fBadChannels.end()){
+    if (IsBadFastOR(absId)){
       AliDebugStream(1) << "Found ADC for masked fastor " << absId << ", rejecting" << std::endl;
       continue;
     }
@@ -385,13 +392,14 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
 
 void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
   // fill the patch ADCs from cells
+  UpdateBadChannelMasks();
   Int_t nCell = cells->GetNumberOfCells();
   for(Int_t iCell = 0; iCell < nCell; ++iCell) {
     // get the cell info, based in index in array
     Short_t cellId = cells->GetCellNumber(iCell);
 
     // Check bad channel map
-    if (fOfflineBadChannels.find(cellId) != fOfflineBadChannels.end()) {
+    if (IsOfflineBadCell(cellId)) {
       AliDebugStream(1) << "Cell " << cellId << " masked as bad channel, rejecting." << std::endl;
       continue;
     }
@@ -407,7 +415,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
       // Exclude FEE amplitudes from cells which are within a TRU which is masked at
       // online level. Using this the online acceptance can be applied to offline
       // patches as well.
-      if(fBadChannels.find(absId) != fBadChannels.end()){
+      if(IsBadFastOR(absId)){
         AliDebugStream(1) << "Cell " << cellId << " corresponding to masked fastor " << absId << ", rejecting." << std::endl;
         continue;
       }
@@ -439,10 +447,48 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
         (*fPatchEnergySimpleSmeared)(icol, irow) = energysmear;
       }
     }
+    BuildSmearedEnergySums();
     AliDebugStream(1) << "Smearing done" << std::endl;
   }
 }
 
+void AliEmcalTriggerMakerKernel::UpdateBadChannelMasks(){
+  if(fBadChannelMasksValid) return;
+  fBadChannelMask.assign(fBadChannels.empty() ? 0 : std::max(0, static_cast<int>(*fBadChannels.rbegin()) + 1), false);
+  for(std::set<Short_t>::const_iterator it = fBadChannels.begin(); it != fBadChannels.end(); ++it){
+    if(*it >= 0) fBadChannelMask[*it] = true;
+  }
+  fOfflineBadChannelMask.assign(fOfflineBadChannels.empty() ? 0 : std::max(0, static_cast<int>(*fOfflineBadChannels.rbegin()) + 1), false);
+  for(std::set<Short_t>::const_iterator it = fOfflineBadChannels.begin(); it != fOfflineBadChannels.end(); ++it){
+    if(*it >= 0) fOfflineBadChannelMask[*it] = true;
+  }
+  fBadChannelMasksValid = kTRUE;
+}
+
+void AliEmcalTriggerMakerKernel::BuildSmearedEnergySums(){
+  // table has one additional column and row of zeros at the lower edges
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows();
+  fSmearedEnergySums.assign((ncols + 1) * (nrows + 1), 0.);
+  for(int icol = 0; icol < ncols; icol++){
+    double colsum = 0;
+    for(int irow = 0; irow < nrows; irow++){
+      colsum += (*fPatchEnergySimpleSmeared)(icol, irow);
+      fSmearedEnergySums[(icol + 1) * (nrows + 1) + irow + 1] = fSmearedEnergySums[icol * (nrows + 1) + irow + 1] + colsum;
+    }
+  }
+}
+
+Double_t AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const {
+  // no table built for this event
+  if(fSmearedEnergySums.empty()) return 0.;
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows();
+  int colmin = std::max(col, 0), colmax = std::min(col + size, ncols),
+      rowmin = std::max(row, 0), rowmax = std::min(row + size, nrows);
+  if(colmin >= colmax || rowmin >= rowmax) return 0.;
+  return fSmearedEnergySums[colmax * (nrows + 1) + rowmax] - fSmearedEnergySums[colmin * (nrows + 1) + rowmax]
+       - fSmearedEnergySums[colmax * (nrows + 1) + rowmin] + fSmearedEnergySums[colmin * (nrows + 1) + rowmin];
+}
+
 void AliEmcalTriggerMakerKernel::BuildL1ThresholdsOffline(const AliVVZERO *vzerodata){
   // get the V0 value and compute and set the offline thresholds
   // get V0, compute thresholds and save them as global parameters
@@ -530,12 +576,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -561,12 +602,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -667,10 +703,12 @@ AliEmcalTriggerMakerKernel::ELevel0TriggerStatus_t AliEmcalTriggerMakerKernel::C
 
 void AliEmcalTriggerMakerKernel::ClearFastORBadChannels(){
   fBadChannels.clear();
+  fBadChannelMasksValid = kFALSE;
 }
 
 void AliEmcalTriggerMakerKernel::ClearOfflineBadChannels() {
   fOfflineBadChannels.clear();
+  fBadChannelMasksValid = kFALSE;
 }
 
 Bool_t AliEmcalTriggerMakerKernel::IsGammaPatch(const AliEMCALTriggerRawPatch &patch) const {
@@ -203,7 +203,7 @@ public:
    * @brief Add a FastOR bad channel to the list
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); }
+  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); fBadChannelMasksValid = kFALSE; }
 
   /**
    * @brief Read the FastOR bad channel map from a standard stream
@@ -226,7 +226,7 @@ public:
    * @brief Add an offline bad channel to the set
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); }
+  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); fBadChannelMasksValid = kFALSE; }
 
   /**
    * @brief Read the offline bad channel map from a standard stream
@@ -459,6 +459,52 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Rebuild the dense bad channel masks from the bad channel sets
+   *
+   * The masks are only rebuilt when the sets changed since the last call
+   * (or after the kernel was read back from file).
+   */
+  void UpdateBadChannelMasks();
+
+  /**
+   * @brief Check whether a FastOR is masked as bad channel
+   * @param[in] absId Absolute ID of the FastOR
+   * @return True if the FastOR is in the list of bad channels
+   */
+  Bool_t IsBadFastOR(Int_t absId) const {
+    if (absId >= 0 && absId < static_cast<Int_t>(fBadChannelMask.size())) return fBadChannelMask[absId];
+    return fBadChannels.find(absId) != fBadChannels.end();
+  }
+
+  /**
+   * @brief Check whether a cell is masked as offline bad channel
+   * @param[in] absId Absolute ID of the cell
+   * @return True if the cell is in the list of offline bad channels
+   */
+  Bool_t IsOfflineBadCell(Int_t absId) const {
+    if (absId >= 0 && absId < static_cast<Int_t>(fOfflineBadChannelMask.size())) return fOfflineBadChannelMask[absId];
+    return fOfflineBadChannels.find(absId) != fOfflineBadChannels.end();
+  }
+
+  /**
+   * @brief Build the summed-area table of the smeared energy grid
+   *
+   * Entry (col, row) of the table contains the sum of all channels with
+   * smaller column and row index, so the energy of any patch can be
+   * obtained from four entries.
+   */
+  void BuildSmearedEnergySums();
+
+  /**
+   * @brief Get the smeared energy of a patch from the summed-area table
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Patch size in FastORs
+   * @return Sum of the smeared energies of the channels in the patch
+   */
+  Double_t GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -495,6 +541,11 @@ protected:
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
+  std::vector<bool>                         fBadChannelMask;              //!<! Dense mask of FastOR bad channels, indexed by abs ID
+  std::vector<bool>                         fOfflineBadChannelMask;       //!<! Dense mask of offline bad cells, indexed by abs ID
+  Bool_t                                    fBadChannelMasksValid;        //!<! Masks are up-to-date with the bad channel sets
+  std::vector<double>                       fSmearedEnergySums;           //!<! Summed-area table of the smeared energy grid
+
   /// \cond CLASSIMP
   ClassDef(AliEmcalTriggerMakerKernel, 4);
   /// \endcond
@@ -32,6 +32,7 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <algorithm>
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -172,7 +173,10 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fCellHead(),
+  fCellNext(),
+  fCandidates()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +326,10 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fCellHead(),
+  fCellNext(),
+  fCandidates()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -511,30 +518,36 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
-  // for each of the A nucleons in nucleus B
-  for (Int_t i = 0; i<fBN; i++)
-  {
-    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    for (Int_t j = 0 ; j < fAN ; j++)
+  if (!fDoFluc) {
+    // fixed cross section: only nucleons of A in the 3x3 transverse cells
+    // around a nucleon of B can be closer than sqrt(d2)
+    CollideOnGrid(d2,bNN,Nco,Ncohc);
+  } else {
+    // for each of the A nucleons in nucleus B
+    for (Int_t i = 0; i<fBN; i++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
-      Double_t dij = dx*dx+dy*dy;
-      if (fDoFluc) {
-	//fXSect = nucleonA->GetSigNN();
-	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
-      }
-      if (dij < d2)
+      AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+      for (Int_t j = 0 ; j < fAN ; j++)
       {
-	bNN += dij;
-	++Nco;
-        nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
-	  ++Ncohc;
+        AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+        Double_t dx = nucleonB->GetX()-nucleonA->GetX();
+        Double_t dy = nucleonB->GetY()-nucleonA->GetY();
+        Double_t dij = dx*dx+dy*dy;
+        if (fDoFluc) {
+	  //fXSect = nucleonA->GetSigNN();
+	  //fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
+	  fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
+	  d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
+        }
+        if (dij < d2)
+        {
+	  bNN += dij;
+	  ++Nco;
+          nucleonB->Collide();
+          nucleonA->Collide();
+	  if (dij<d2/4)
+	    ++Ncohc;
+        }
       }
     }
   }
@@ -554,6 +567,80 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   return CalcResults(bgen);
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::CollideOnGrid(Double_t d2, Double_t &bNN, Double_t &Nco, Double_t &Ncohc)
+{
+  // collide the nucleons of A and B for a fixed interaction distance sqrt(d2);
+  // nucleons of A are binned on a transverse grid with cells of at least
+  // sqrt(d2) and the candidates of each nucleon of B are visited in the
+  // original order, so that the sums are identical to the full double loop
+
+  if (fAN<=0 || fBN<=0 || d2<=0) return;
+
+  const std::vector<Double_t> &xA = fANucleus.GetNucleonX();
+  const std::vector<Double_t> &yA = fANucleus.GetNucleonY();
+  const std::vector<Double_t> &xB = fBNucleus.GetNucleonX();
+  const std::vector<Double_t> &yB = fBNucleus.GetNucleonY();
+
+  Double_t xmin = xA[0], xmax = xA[0];
+  Double_t ymin = yA[0], ymax = yA[0];
+  for (Int_t j = 1; j<fAN; j++) {
+    xmin = TMath::Min(xmin,xA[j]);
+    xmax = TMath::Max(xmax,xA[j]);
+    ymin = TMath::Min(ymin,yA[j]);
+    ymax = TMath::Max(ymax,yA[j]);
+  }
+
+  // positions outside the grid are clamped to the border cells, which keeps
+  // every pair closer than one cell width in neighbouring cells
+  const Int_t kMaxCells = 256;
+  Double_t w  = TMath::Sqrt(d2)*(1+1e-9);
+  Int_t    nx = TMath::Min(kMaxCells,Int_t((xmax-xmin)/w)+1);
+  Int_t    ny = TMath::Min(kMaxCells,Int_t((ymax-ymin)/w)+1);
+  Double_t wx = TMath::Max(w,(xmax-xmin)/nx);
+  Double_t wy = TMath::Max(w,(ymax-ymin)/ny);
+
+  fCellHead.assign(nx*ny,-1);
+  fCellNext.resize(fAN);
+  for (Int_t j = fAN-1; j>=0; j--) {
+    Int_t ix = TMath::Min(nx-1,Int_t((xA[j]-xmin)/wx));
+    Int_t iy = TMath::Min(ny-1,Int_t((yA[j]-ymin)/wy));
+    fCellNext[j] = fCellHead[ix*ny+iy];
+    fCellHead[ix*ny+iy] = j;
+  }
+
+  for (Int_t i = 0; i<fBN; i++)
+  {
+    Int_t ix = TMath::Max(0,TMath::Min(nx-1,Int_t(TMath::Floor((xB[i]-xmin)/wx))));
+    Int_t iy = TMath::Max(0,TMath::Min(ny-1,Int_t(TMath::Floor((yB[i]-ymin)/wy))));
+    fCandidates.clear();
+    for (Int_t jx = TMath::Max(0,ix-1); jx<=TMath::Min(nx-1,ix+1); jx++)
+      for (Int_t jy = TMath::Max(0,iy-1); jy<=TMath::Min(ny-1,iy+1); jy++)
+        for (Int_t j = fCellHead[jx*ny+jy]; j>=0; j = fCellNext[j])
+          fCandidates.push_back(j);
+    if (fCandidates.empty()) continue;
+    std::sort(fCandidates.begin(),fCandidates.end());
+
+    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    for (UInt_t k = 0; k<fCandidates.size(); k++)
+    {
+      Int_t j = fCandidates[k];
+      Double_t dx = xB[i]-xA[j];
+      Double_t dy = yB[i]-yA[j];
+      Double_t dij = dx*dx+dy*dy;
+      if (dij < d2)
+      {
+	bNN += dij;
+	++Nco;
+        nucleonB->Collide();
+        ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide();
+	if (dij<d2/4)
+	  ++Ncohc;
+      }
+    }
+  }
+}
+
 //______________________________________________________________________________
 Bool_t AliGlauberMC::CalcResults(Double_t bgen)
 {
@@ -16,6 +16,7 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
@@ -251,7 +252,11 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   std::vector<Int_t> fCellHead;   //!first nucleon of A in each transverse cell
+   std::vector<Int_t> fCellNext;   //!next nucleon of A in the same cell
+   std::vector<Int_t> fCandidates; //!nucleons of A in the cells around a nucleon of B
    Bool_t       CalcResults(Double_t bgen);
+   void         CollideOnGrid(Double_t d2, Double_t &bNN, Double_t &Nco, Double_t &Ncohc);
 
    ClassDef(AliGlauberMC,4)
 };
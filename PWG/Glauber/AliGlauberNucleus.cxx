@@ -49,7 +49,12 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fNucleonX(),
+  fNucleonY(),
+  fNucleonZ(),
+  fCellHead(),
+  fCellNext()
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -77,7 +82,12 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fF(in.fF),
   fTrials(in.fTrials),
   fFunction(in.fFunction),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fNucleonX(in.fNucleonX),
+  fNucleonY(in.fNucleonY),
+  fNucleonZ(in.fNucleonZ),
+  fCellHead(),
+  fCellNext()
 {
   //copy ctor
   if (in.fNucleons)
@@ -97,6 +107,9 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   fF=in.fF;
   fTrials=in.fTrials;
   fFunction=in.fFunction;
+  fNucleonX=in.fNucleonX;
+  fNucleonY=in.fNucleonY;
+  fNucleonZ=in.fNucleonZ;
   delete fNucleons;
   fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
   fNucleons->SetOwner();
@@ -237,6 +250,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       }
    } 
    
+   fNucleonX.resize(fN);
+   fNucleonY.resize(fN);
+   fNucleonZ.resize(fN);
    fTrials = 0;
 
    Double_t sumx=0;       
@@ -262,12 +278,39 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
 		       -nucleon1->GetY(),
 		       -nucleon1->GetZ());
       fTrials = 1;
+      for (Int_t i = 0; i<fN; i++) {
+         AliGlauberNucleon *nucleon=(AliGlauberNucleon*)(fNucleons->UncheckedAt(i));
+         fNucleonX[i] = nucleon->GetX();
+         fNucleonY[i] = nucleon->GetY();
+         fNucleonZ[i] = nucleon->GetZ();
+      }
       return;
    }
 
+   // transverse grid of the nucleons accepted so far, used for the hard-core
+   // test; cells are at least fMinDist wide, so only the 3x3 cells around a
+   // trial position can hold a nucleon closer than fMinDist (positions outside
+   // the grid are clamped to the border cells)
+   Bool_t   useGrid = (fMinDist>0);
+   Int_t    nCells  = 1;
+   Double_t cellX0  = 0;
+   Double_t cellY0  = 0;
+   Double_t cellW   = 1;
+   if (useGrid) {
+      const Int_t kMaxCells = 128;
+      Double_t rmax = fFunction->GetXmax();
+      nCells = TMath::Max(1,TMath::Min(kMaxCells,Int_t(2*rmax/fMinDist)));
+      cellW  = TMath::Max(fMinDist,2*rmax/nCells);
+      cellX0 = xshift-rmax;
+      cellY0 = -rmax;
+      fCellHead.assign(nCells*nCells,-1);
+      fCellNext.resize(fN);
+   }
+
    for (Int_t i = 0; i<fN; i++) {
       AliGlauberNucleon *nucleon=(AliGlauberNucleon*)(fNucleons->UncheckedAt(i));
       nucleon->Reset();
+      Int_t cell = 0;
       while(1) {
          fTrials++;
          Double_t r = fFunction->GetRandom();
@@ -278,24 +321,38 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
          Double_t y = r * stheta * sin(phi);      
          Double_t z = r * ctheta;      
          nucleon->SetXYZ(x,y,z);
+         fNucleonX[i] = nucleon->GetX();
+         fNucleonY[i] = nucleon->GetY();
+         fNucleonZ[i] = nucleon->GetZ();
          if(fMinDist<0) break;
+         if(!useGrid) break; // fMinDist==0: no pair can be closer
+         Int_t ix = TMath::Max(0,TMath::Min(nCells-1,Int_t(TMath::Floor((x-cellX0)/cellW))));
+         Int_t iy = TMath::Max(0,TMath::Min(nCells-1,Int_t(TMath::Floor((y-cellY0)/cellW))));
+         cell = ix*nCells+iy;
          Bool_t test=1;
-         for (Int_t j = 0; j<i; j++) {
-            AliGlauberNucleon *other=(AliGlauberNucleon*)fNucleons->UncheckedAt(j);
-            Double_t xo=other->GetX();
-            Double_t yo=other->GetY();
-            Double_t zo=other->GetZ();
-            Double_t dist = TMath::Sqrt((x-xo)*(x-xo)+
-                                       (y-yo)*(y-yo)+
-                                       (z-zo)*(z-zo));
+         for (Int_t jx = TMath::Max(0,ix-1); test && jx<=TMath::Min(nCells-1,ix+1); jx++) {
+            for (Int_t jy = TMath::Max(0,iy-1); test && jy<=TMath::Min(nCells-1,iy+1); jy++) {
+               for (Int_t j = fCellHead[jx*nCells+jy]; j>=0; j = fCellNext[j]) {
+                  Double_t xo=fNucleonX[j];
+                  Double_t yo=fNucleonY[j];
+                  Double_t zo=fNucleonZ[j];
+                  Double_t dist = TMath::Sqrt((x-xo)*(x-xo)+
+                                             (y-yo)*(y-yo)+
+                                             (z-zo)*(z-zo));
 	       
-            if(dist<fMinDist) {
-               test=0;
-               break;
+                  if(dist<fMinDist) {
+                     test=0;
+                     break;
+                  }
+               }
             }
          }
          if (test) break; //found nucleuon outside of mindist
       }
+      if (useGrid) {
+         fCellNext[i] = fCellHead[cell];
+         fCellHead[cell] = i;
+      }
            
       sumx += nucleon->GetX();
       sumy += nucleon->GetY();
@@ -311,6 +368,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
          nucleon->SetXYZ(nucleon->GetX()-sumx-xshift,
                          nucleon->GetY()-sumy,
                          nucleon->GetZ()-sumz);
+         fNucleonX[i] = nucleon->GetX();
+         fNucleonY[i] = nucleon->GetY();
+         fNucleonZ[i] = nucleon->GetZ();
       }
    }
 }
@@ -16,6 +16,7 @@
 
 //class TNamed;
 #include <TNamed.h>
+#include <vector>
 class TObjArray;
 class TF1;
 
@@ -30,6 +31,11 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   std::vector<Double_t> fNucleonX;  //!x of nucleons (same order as fNucleons)
+   std::vector<Double_t> fNucleonY;  //!y of nucleons (same order as fNucleons)
+   std::vector<Double_t> fNucleonZ;  //!z of nucleons (same order as fNucleons)
+   std::vector<Int_t>    fCellHead;  //!first accepted nucleon per transverse cell (hard core)
+   std::vector<Int_t>    fCellNext;  //!next accepted nucleon in the same cell (hard core)
 
    void       Lookup(Option_t* name);
 
@@ -47,6 +53,8 @@ public:
    Double_t   GetW()             const {return fW;}
    TObjArray *GetNucleons()      const {return fNucleons;}
    Int_t      GetTrials()        const {return fTrials;}
+   const std::vector<Double_t> &GetNucleonX() const {return fNucleonX;}
+   const std::vector<Double_t> &GetNucleonY() const {return fNucleonY;}
    void       SetN(Int_t in)           {fN=in;}
    void       SetR(Double_t ir);
    void       SetA(Double_t ia);
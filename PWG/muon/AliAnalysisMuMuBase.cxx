@@ -69,11 +69,28 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fHistoHandles(),
+fHistoHandleNames(),
+fHistoHandleDisabled(),
+fPathHandles(),
+fPathHandleNames(),
+fHandleObjects()
 {
  /// default ctor
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ClearHandleObjects()
+{
+  /// Forget the objects found through handles (they belong to the previous collection)
+
+  for ( std::vector< std::vector<TObject*> >::size_type i = 0; i < fHandleObjects.size(); ++i )
+  {
+    fHandleObjects[i].assign(fHandleObjects[i].size(),static_cast<TObject*>(0x0));
+  }
+}
+
 //_____________________________________________________________________________
 TString AliAnalysisMuMuBase::BuildPath(const char* eventSelection, const char* triggerClassName,
                                        const char* centrality, const char* cut) const
@@ -407,6 +424,8 @@ void AliAnalysisMuMuBase::DisableHistograms(const char* pattern)
   }
 
   fHistogramToDisable->Add(new TObjString(spattern));
+
+  fHistoHandleDisabled.assign(fHistoHandleDisabled.size(),-1);
 }
 
 //_____________________________________________________________________________
@@ -429,6 +448,82 @@ Int_t AliAnalysisMuMuBase::GetNbins(Double_t xmin, Double_t xmax, Double_t xstep
   return TMath::Nint(TMath::Abs((xmax-xmin)/xstep));
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::HistoHandle(const char* histoname)
+{
+  /// Get the handle of a histogram name, registering it if needed.
+  /// Meant to be called once (e.g. at initialization), not for each fill
+
+  std::map<std::string,Int_t>::const_iterator it = fHistoHandles.find(histoname);
+  if ( it != fHistoHandles.end() ) return it->second;
+
+  Int_t handle = fHistoHandleNames.size();
+  fHistoHandles[histoname] = handle;
+  fHistoHandleNames.push_back(histoname);
+  fHistoHandleDisabled.push_back(-1);
+  return handle;
+}
+
+//_____________________________________________________________________________
+TH1* AliAnalysisMuMuBase::HistoFromHandle(Int_t pathHandle, Int_t histoHandle)
+{
+  /// Get one histo back from its handles
+  return static_cast<TH1*>(ObjectFromHandle(pathHandle,histoHandle));
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuBase::IsHistoHandleDisabled(Int_t histoHandle)
+{
+  /// Same as IsHistogramDisabled for a histogram handle, the pattern matching
+  /// being done only once per handle
+
+  if ( histoHandle < 0 ) return kTRUE;
+
+  if ( fHistoHandleDisabled[histoHandle] < 0 )
+  {
+    fHistoHandleDisabled[histoHandle] = IsHistogramDisabled(HistoHandleName(histoHandle)) ? 1 : 0;
+  }
+  return ( fHistoHandleDisabled[histoHandle] == 1 );
+}
+
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::ObjectFromHandle(Int_t pathHandle, Int_t histoHandle)
+{
+  /// Get one object back from its handles.
+  /// The (path,name) lookup in the collection is only done until the object is found
+
+  if ( pathHandle < 0 || histoHandle < 0 || !fHistogramCollection ) return 0x0;
+
+  std::vector<TObject*>& objects = fHandleObjects[pathHandle];
+  if ( histoHandle >= static_cast<Int_t>(objects.size()) ) objects.resize(fHistoHandleNames.size(),0x0);
+
+  TObject* o = objects[histoHandle];
+  if ( !o )
+  {
+    o = fHistogramCollection->GetObject(fPathHandleNames[pathHandle].c_str(),HistoHandleName(histoHandle));
+    objects[histoHandle] = o;
+  }
+  return o;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::PathHandle(const char* path)
+{
+  /// Get the handle of a path (e.g. from BuildPath), registering it if needed
+
+  std::map<std::string,Int_t>::const_iterator it = fPathHandles.find(path);
+  if ( it != fPathHandles.end() ) return it->second;
+
+  TString spath(path);
+  if ( spath.EndsWith("/") ) spath.Remove(spath.Length()-1);
+
+  Int_t handle = fPathHandleNames.size();
+  fPathHandles[path] = handle;
+  fPathHandleNames.push_back(spath.Data());
+  fHandleObjects.push_back(std::vector<TObject*>(fHistoHandleNames.size(),static_cast<TObject*>(0x0)));
+  return handle;
+}
+
 //_____________________________________________________________________________
 TH1* AliAnalysisMuMuBase::Histo(const char* eventSelection, const char* triggerClassName, const char* histoname)
 {
@@ -518,6 +613,8 @@ void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
   fHistogramCollection = &hc;
   fBinning             = &binning;
   fCutRegistry         = &registry;
+
+  ClearHandleObjects();
 }
 
 //_____________________________________________________________________________
@@ -13,6 +13,9 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -101,7 +104,7 @@ public:
   Bool_t AlwaysFalse(const AliVParticle& /*particle*/, const AliVParticle& /*particle*/) const { return kFALSE; }
   void NameOfAlwaysFalse(TString& name) const { name = "NONE"; }
 
-  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; }
+  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; ClearHandleObjects(); }
 
 protected:
 
@@ -192,6 +195,17 @@ protected:
   TProfile* MCProf(const char* eventSelection, const char* triggerClassName, const char* cent,
                  const char* what, const char* histoname);
 
+  /** Histogram handles : a histogram name and a path are registered once as integers,
+   * and the (path,name) object is then looked up in the collection only at its first use.
+   */
+  Int_t HistoHandle(const char* histoname);
+  Int_t PathHandle(const char* path);
+  TObject* ObjectFromHandle(Int_t pathHandle, Int_t histoHandle);
+  TH1* HistoFromHandle(Int_t pathHandle, Int_t histoHandle);
+  TProfile* ProfFromHandle(Int_t pathHandle, Int_t histoHandle) { return static_cast<TProfile*>(ObjectFromHandle(pathHandle,histoHandle)); }
+  const char* HistoHandleName(Int_t histoHandle) const { return fHistoHandleNames[histoHandle].c_str(); }
+  Bool_t IsHistoHandleDisabled(Int_t histoHandle);
+
   Int_t GetNbins(Double_t xmin, Double_t xmax, Double_t xstep);
 
   AliCounterCollection* CounterCollection() const { return fEventCounters; }
@@ -201,6 +215,8 @@ protected:
 
 private:
 
+  void ClearHandleObjects();
+
   /// not implemented on purpose
   AliAnalysisMuMuBase& operator=(const AliAnalysisMuMuBase& rhs);
   /// not implemented on purpose
@@ -215,6 +231,13 @@ private:
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
 
+  std::map<std::string,Int_t> fHistoHandles; //! handle of each registered histogram name
+  std::vector<std::string> fHistoHandleNames; //! histogram name of each handle
+  std::vector<Int_t> fHistoHandleDisabled; //! whether the histogram of each handle is disabled (-1 = not known yet)
+  std::map<std::string,Int_t> fPathHandles; //! handle of each registered path
+  std::vector<std::string> fPathHandleNames; //! path of each handle (without trailing slash)
+  std::vector< std::vector<TObject*> > fHandleObjects; //! objects found so far, per path and histogram handle
+
   ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
 };
 
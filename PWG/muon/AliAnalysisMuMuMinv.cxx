@@ -49,7 +49,11 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fHandles(),
+fPairDistHandles(),
+fMinvHandles(),
+fPairPaths()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -66,6 +70,58 @@ AliAnalysisMuMuMinv::~AliAnalysisMuMuMinv()
   /// dtor
   delete fAccEffHisto;
   delete fBinsToFill;
+  ClearPairPaths();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::SetEvent(AliVEvent* event, AliMCEvent* mcEvent)
+{
+  /// Set the event and forget the pair paths of the previous one (the name
+  /// pointers used as keys are only guaranteed to be stable within an event)
+
+  AliAnalysisMuMuBase::SetEvent(event,mcEvent);
+  ClearPairPaths();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::ClearPairPaths()
+{
+  /// Delete the cached proxies and forget the pair paths
+
+  for ( std::vector<PairPath>::size_type i = 0; i < fPairPaths.size(); ++i ) delete fPairPaths[i].fProxy;
+  fPairPaths.clear();
+}
+
+//_____________________________________________________________________________
+AliAnalysisMuMuMinv::PairPath&
+AliAnalysisMuMuMinv::GetPairPath(const char* eventSelection, const char* triggerClassName,
+                                 const char* centrality, const char* pairCutName)
+{
+  /// Get the path handle and proxy of a pair selection. They are built on the
+  /// first pair of the selection in the event and reused for the other pairs,
+  /// so that the pair loop does not rebuild the path string, the proxy and
+  /// the path handle for each pair.
+
+  for ( std::vector<PairPath>::size_type i = 0; i < fPairPaths.size(); ++i )
+  {
+    PairPath& p = fPairPaths[i];
+    if ( p.fEventSelection == eventSelection && p.fTriggerClassName == triggerClassName &&
+         p.fCentrality == centrality && p.fPairCutName == pairCutName ) return p;
+  }
+
+  TString path = BuildPath(eventSelection,triggerClassName,centrality,pairCutName);
+
+  PairPath p;
+  p.fEventSelection = eventSelection;
+  p.fTriggerClassName = triggerClassName;
+  p.fCentrality = centrality;
+  p.fPairCutName = pairCutName;
+  p.fPathHandle = PathHandle(path.Data());
+  p.fMCPathHandle = -1;
+  p.fProxy = HistogramCollection()->CreateProxy(path);
+  fPairPaths.push_back(p);
+
+  return fPairPaths.back();
 }
 
 //_____________________________________________________________________________
@@ -330,9 +386,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
   // Get total charge in order to get the correct histo name
   Double_t PairCharge = tracki.Charge() + trackj.Charge();
-  TString scharge  = "";
-  if( PairCharge == +2 )      scharge = "PP";
-  else if( PairCharge == -2 ) scharge = "MM";
 
   // Pointers in case running on MC
   Int_t labeli               = 0;
@@ -342,12 +395,16 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
 
-  // Usefull string :)
-  TString smix = IsMixedHisto ? "Mix" : "";
+  // Histogram handles (see RegisterHistoHandles), with the charge and mix of the pair
+  if ( fHandles.empty() ) RegisterHistoHandles();
+  const Int_t chargeIndex = GetChargeIndex(PairCharge);
+  const Int_t mixIndex    = IsMixedHisto ? 1 : 0;
 
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
-  AliMergeableCollectionProxy* mcProxy(0x0); // to be set later maybe
+  // Path handles and proxy in AliMergeableCollection, shared by all the pairs of this selection
+  PairPath& pairPath = GetPairPath(eventSelection,triggerClassName,centrality,pairCutName);
+  AliMergeableCollectionProxy* proxy = pairPath.fProxy;
+  const Int_t pathHandle = pairPath.fPathHandle;
+  Int_t mcPathHandle(-1); // to be set later maybe
 
   // Construct dimuons vector
   TLorentzVector pi(tracki.Px(),tracki.Py(),tracki.Pz(),
@@ -374,8 +431,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     mcTracki = MCEvent()->GetTrack(labeli);
     if(!mcTracki) return;
     if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -383,8 +438,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     mcTrackj = MCEvent()->GetTrack(labelj);
     if(!mcTrackj) return;
     if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -392,26 +445,18 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Int_t currMotheri = mcTracki->GetMother();
     Int_t currMotherj = mcTrackj->GetMother();
     if( currMotheri!=currMotherj ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
     if( currMotheri<0 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
     // Check if mother is J/psi
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
     if(!mother){
-      delete proxy;
-      delete mcProxy;
       return;
     }
     if(mother->PdgCode() !=443) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -423,13 +468,12 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
     if(!mcTracki || !mcTrackj){
       AliError("Miss one or several MC track");
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
+    // Path handle for MC
+    if ( pairPath.fMCPathHandle < 0 ) pairPath.fMCPathHandle = PathHandle(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName).Data());
+    mcPathHandle = pairPath.fMCPathHandle;
     TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
@@ -441,25 +485,26 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt")  ) {
+  if ( !IsHistoHandleDisabled(fHandles[kHandlePt])  ) {
     Double_t x[2] = {pair4Momentum.Pt(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* h = static_cast<THnSparse*>(ObjectFromHandle(pathHandle,fPairDistHandles[GetPairDistHandleIndex(0,mixIndex,chargeIndex)]));
+    if(h) h->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Y")   ){
+  if ( !IsHistoHandleDisabled(fHandles[kHandleY])   ){
     Double_t x[2] = {pair4Momentum.Rapidity(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* h = static_cast<THnSparse*>(ObjectFromHandle(pathHandle,fPairDistHandles[GetPairDistHandleIndex(1,mixIndex,chargeIndex)]));
+    if(h) h->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Eta") ){
+  if ( !IsHistoHandleDisabled(fHandles[kHandleEta]) ){
     Double_t x[2] = {pair4Momentum.Eta(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* h = static_cast<THnSparse*>(ObjectFromHandle(pathHandle,fPairDistHandles[GetPairDistHandleIndex(2,mixIndex,chargeIndex)]));
+    if(h) h->Fill(x,inputWeight);
   }
 
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( !IsHistoHandleDisabled(fHandles[kHandlePtPaireVsPtTrack]) && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
+    TH2* h = static_cast<TH2*>(HistoFromHandle(pathHandle,fHandles[kHandlePtPaireVsPtTrack]));
+    h->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+    h->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
   }
 
   // Fill histos with MC stack info (only opposite charge muons)
@@ -472,10 +517,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
 
     // Fill histo
-    if ( proxy->Histo("PtRecVsSim") )  proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( mcProxy->Histo("Pt"))  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( mcProxy->Histo("Y"))   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( mcProxy->Histo("Eta")) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    TH1* h(0x0);
+    if ( ( h = HistoFromHandle(pathHandle,fHandles[kHandlePtRecVsSim]) ) ) h->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( ( h = HistoFromHandle(mcPathHandle,fHandles[kHandlePt]) ) )       h->Fill(mcpj.Pt(),inputWeightMC);
+    if ( ( h = HistoFromHandle(mcPathHandle,fHandles[kHandleY]) ) )        h->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( ( h = HistoFromHandle(mcPathHandle,fHandles[kHandleEta]) ) )      h->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
@@ -484,6 +530,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TIter nextBin(fBinsToFill);
   nextBin.Reset();
   AliAnalysisMuMuBinning::Range* r;
+  Int_t ib(0);
 
   // Loop over all bin ranges
   while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
@@ -497,16 +544,15 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     ok = CheckBinRangeCut(r,&pair4Momentum,proxy);
     if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,proxy);
 
+    // Handles of the Minv histo and mean pt profiles associated to the bin
+    const Int_t* handles        = &fMinvHandles[GetMinvHandleIndex(ib,0,mixIndex,chargeIndex)];
+    const Int_t* handlesAccEff  = &fMinvHandles[GetMinvHandleIndex(ib,1,mixIndex,chargeIndex)];
+    ++ib;
+
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok )
     {
-      // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(pathHandle,handles,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +565,13 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(pathHandle,handlesAccEff,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(mcPathHandle,handles,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,18 +584,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(mcPathHandle,handlesAccEff,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
   }
-  delete proxy;
-  delete mcProxy;
 }
 
 
@@ -687,26 +716,35 @@ void AliAnalysisMuMuMinv::FillHistosForMCEvent(const char* eventSelection,const
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight)
+void AliAnalysisMuMuMinv::FillMinvHisto(Int_t pathHandle, const Int_t* handles, TLorentzVector* pair4Momentum, Double_t inputWeight)
 {
-  /// Create, fill and store Minv histo
-  if (!IsHistogramDisabled(minvName->Data())){
+  /// Same as above, with the Minv histo and the two mean pt profiles given by their handles (see RegisterHistoHandles)
+  if (!IsHistoHandleDisabled(handles[0])){
 
-    TH1* h(0x0);
-
-    h = proxy->Histo(minvName->Data());
+    TH1* h = HistoFromHandle(pathHandle,handles[0]);
     if (h) h->Fill(pair4Momentum->M(),inputWeight);
 
     // Fill Mean pT
     if ( fComputeMeanPt ){
-      if ( !hprof ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      TProfile* hprof  = ProfFromHandle(pathHandle,handles[1]);
+      TProfile* hprof2 = ProfFromHandle(pathHandle,handles[2]);
+      if ( !hprof ) AliError(Form("Could not get hprofile for %s",HistoHandleName(handles[0])));
       else hprof->Fill(pair4Momentum->M(),pair4Momentum->Pt(),inputWeight);
-      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",HistoHandleName(handles[0])));
       else hprof2->Fill(pair4Momentum->M(),pair4Momentum->Pt()*pair4Momentum->Pt(),inputWeight);
     }
   }
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuMinv::GetChargeIndex(Double_t PairCharge)
+{
+  /// Index of the pair charge used with the histogram handles (0 : +-, 1 : ++, 2 : --)
+  if ( PairCharge == +2 ) return 1;
+  if ( PairCharge == -2 ) return 2;
+  return 0;
+}
+
 //_____________________________________________________________________________
 TString AliAnalysisMuMuMinv::GetMinvHistoName(const AliAnalysisMuMuBinning::Range& r, Bool_t accEffCorrected, Double_t PairCharge, Bool_t mix) const
 {
@@ -1105,11 +1143,75 @@ Bool_t AliAnalysisMuMuMinv::IsRapidityInRange(const AliVParticle& t1, const AliV
   return  ( -4.0 < y && y < -2.5  );
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::Init(AliCounterCollection& cc,
+                               AliMergeableCollection& hc,
+                               const AliAnalysisMuMuBinning& binning,
+                               const AliAnalysisMuMuCutRegistry& cutRegister)
+{
+  /// Set the internal references and register the histogram handles
+  AliAnalysisMuMuBase::Init(cc,hc,binning,cutRegister);
+  RegisterHistoHandles();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::RegisterHistoHandles()
+{
+  /// Turn the names of all the histograms filled for each pair (which only depend
+  /// on the configuration) into handles, so that no name is built during the fills.
+  /// Has to be redone whenever the bins to fill or the bin naming change
+
+  const char* quantities[] = { "Pt", "Y", "Eta" };
+  const char* charges[] = { "", "PP", "MM" };
+  const Double_t pairCharges[] = { 0, 2, -2 };
+
+  fHandles.resize(kNHandles);
+  fHandles[kHandlePt]               = HistoHandle("Pt");
+  fHandles[kHandleY]                = HistoHandle("Y");
+  fHandles[kHandleEta]              = HistoHandle("Eta");
+  fHandles[kHandlePtPaireVsPtTrack] = HistoHandle("PtPaireVsPtTrack");
+  fHandles[kHandlePtRecVsSim]       = HistoHandle("PtRecVsSim");
+
+  fPairDistHandles.resize(GetPairDistHandleIndex(3,0,0));
+  for ( Int_t iq = 0; iq < 3; ++iq ){
+    for ( Int_t imix = 0; imix < 2; ++imix ){
+      for ( Int_t ich = 0; ich < 3; ++ich ){
+        fPairDistHandles[GetPairDistHandleIndex(iq,imix,ich)] = HistoHandle(Form("%s%s%s",quantities[iq],imix ? "Mix" : "",charges[ich]));
+      }
+    }
+  }
+
+  TIter nextBin(fBinsToFill);
+  AliAnalysisMuMuBinning::Range* r;
+  Int_t nbins(0);
+  while ( nextBin() ) ++nbins;
+
+  fMinvHandles.resize(GetMinvHandleIndex(nbins,0,0,0));
+  nextBin.Reset();
+  Int_t ib(0);
+
+  while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
+    for ( Int_t iacc = 0; iacc < 2; ++iacc ){
+      for ( Int_t imix = 0; imix < 2; ++imix ){
+        for ( Int_t ich = 0; ich < 3; ++ich ){
+          TString minvName = GetMinvHistoName(*r,iacc,pairCharges[ich],imix);
+          Int_t* handles = &fMinvHandles[GetMinvHandleIndex(ib,iacc,imix,ich)];
+          handles[0] = HistoHandle(minvName.Data());
+          handles[1] = HistoHandle(Form("MeanPtVs%s",minvName.Data()));
+          handles[2] = HistoHandle(Form("MeanPtSquareVs%s",minvName.Data()));
+        }
+      }
+    }
+    ++ib;
+  }
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+  fHandles.clear(); // handles registered again at the next fill
 }
 
 //________________________________________________________________________
@@ -19,6 +19,8 @@ class TH2F;
 class AliVParticle;
 class TLorentzVector;
 class AliMergeableCollectionProxy;
+class AliCounterCollection;
+class AliAnalysisMuMuCutRegistry;
 
 class AliAnalysisMuMuMinv : public AliAnalysisMuMuBase
 {
@@ -43,7 +45,7 @@ public:
 
   void SetMuonWeight() { fWeightMuon=kTRUE; }
 
-  void SetLegacyBinNaming() { fMinvBinSeparator = ""; }
+  void SetLegacyBinNaming() { fMinvBinSeparator = ""; fHandles.clear(); }
 
   void SetBinsToFill(const char* particle, const char* bins);
 
@@ -58,6 +60,13 @@ public:
 
   void DefineMinvRange(Double_t minvMin, Double_t minvMax, Double_t minvBinSize);
 
+  virtual void Init(AliCounterCollection& cc,
+                    AliMergeableCollection& hc,
+                    const AliAnalysisMuMuBinning& binning,
+                    const AliAnalysisMuMuCutRegistry& cutRegister);
+
+  virtual void SetEvent(AliVEvent* event, AliMCEvent* mcEvent=0x0);
+
 protected:
 
   void DefineHistogramCollection(const char* eventSelection, const char* triggerClassName,
@@ -72,10 +81,40 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
-  void FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight);
+  void FillMinvHisto(Int_t pathHandle, const Int_t* handles, TLorentzVector* pair4Momentum, Double_t inputWeight);
 
 private:
 
+  /// Histogram names with a fixed handle
+  enum EHandle { kHandlePt, kHandleY, kHandleEta, kHandlePtPaireVsPtTrack, kHandlePtRecVsSim, kNHandles };
+
+  /// Path handles and proxy of one (eventSelection, trigger, centrality, pairCut) combination
+  struct PairPath
+  {
+    const char* fEventSelection; ///< event selection name (pointer used as key)
+    const char* fTriggerClassName; ///< trigger class name (pointer used as key)
+    const char* fCentrality; ///< centrality name (pointer used as key)
+    const char* fPairCutName; ///< pair cut name (pointer used as key)
+    Int_t fPathHandle; ///< handle of the reconstructed path
+    Int_t fMCPathHandle; ///< handle of the MC path (-1 until first needed)
+    AliMergeableCollectionProxy* fProxy; ///< proxy to the reconstructed path (owned)
+  };
+
+  PairPath& GetPairPath(const char* eventSelection, const char* triggerClassName,
+                        const char* centrality, const char* pairCutName);
+
+  void ClearPairPaths();
+
+  void RegisterHistoHandles();
+
+  static Int_t GetChargeIndex(Double_t PairCharge);
+
+  /// index in fPairDistHandles of the Pt, Y or Eta (quantity = 0, 1, 2) pair distribution
+  Int_t GetPairDistHandleIndex(Int_t quantity, Int_t mix, Int_t charge) const { return (quantity*2+mix)*3+charge; }
+
+  /// index in fMinvHandles of the handles of the Minv histo, mean pt and mean pt square profiles of one bin
+  Int_t GetMinvHandleIndex(Int_t bin, Int_t accEff, Int_t mix, Int_t charge) const { return (((bin*2+accEff)*2+mix)*3+charge)*3; }
+
   void CreateMinvHistograms(const char* eventSelection, const char* triggerClassName, const char* centrality);
 
   // normalize the function to its integral in the given range
@@ -112,6 +151,11 @@ private:
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
 
+  std::vector<Int_t> fHandles; //! handles of the fixed histogram names (see EHandle)
+  std::vector<Int_t> fPairDistHandles; //! handles of the Pt, Y and Eta pair distributions, per quantity, mix and charge
+  std::vector<Int_t> fMinvHandles; //! handles of the Minv histos and mean pt profiles, per bin, AccxEff correction, mix and charge
+  std::vector<PairPath> fPairPaths; //! path handles and proxies of the pair selections seen in the current event
+
   ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
@@ -12,12 +12,16 @@
 #include "TMath.h"
 #include "TParameter.h"
 #include "TTree.h"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
 /// \ingroup compact
 AliMuonCompactQuickAccEff::AliMuonCompactQuickAccEff(int maxevents, bool rejectMonoCathodeClusters)
-    : fMaxEvents(maxevents), fRejectMonoCathodeClusters(rejectMonoCathodeClusters)
+    : fMaxEvents(maxevents), fRejectMonoCathodeClusters(rejectMonoCathodeClusters),
+    fTrackClusterStart(), fClusterBendingManu(), fClusterNonBendingManu(),
+    fClusterChamber(), fTrackValidWithoutBadManu(), fManuTrackStart(),
+    fManuTracks(), fPairs()
 {
 }
 
@@ -73,11 +77,16 @@ Bool_t AliMuonCompactQuickAccEff::ValidateCluster(const AliMuonCompactCluster& c
         nonBendingMask=manuStatus[cl.NonBendingManuIndex()];
     }
 
-    Bool_t station12 = ( cl.BendingManuIndex() >=0 && cl.BendingManuIndex() < 7152 ) ||
-            ( cl.NonBendingManuIndex() >=0 && cl.NonBendingManuIndex() < 7152 );
+    return ValidateCluster(cl.BendingManuIndex(),cl.NonBendingManuIndex(),
+            ( bendingMask & causeMask ) == 0,
+            ( nonBendingMask & causeMask ) == 0);
+}
 
-    Bool_t bendingIsOK = (  ( bendingMask & causeMask ) == 0);
-    Bool_t nonBendingIsOK = (  ( nonBendingMask & causeMask ) == 0);
+Bool_t AliMuonCompactQuickAccEff::ValidateCluster(Int_t bendingManuIndex, Int_t nonBendingManuIndex,
+        Bool_t bendingIsOK, Bool_t nonBendingIsOK) const
+{
+    Bool_t station12 = ( bendingManuIndex >=0 && bendingManuIndex < 7152 ) ||
+            ( nonBendingManuIndex >=0 && nonBendingManuIndex < 7152 );
 
     if ( fRejectMonoCathodeClusters )
     {
@@ -112,16 +121,7 @@ Bool_t AliMuonCompactQuickAccEff::ValidateTrack(const AliMuonCompactTrack& track
 
     if ( manuStatus.empty() || causeMask == 0 ) return kTRUE;
 
-    Int_t currentCh;
-    Int_t currentSt;
-    Int_t previousCh = -1;
-    Int_t nChHitInSt4 = 0;
-    Int_t nChHitInSt5 = 0;
-    UInt_t presentStationMask = 0;
-    const UInt_t requestedStationMask = 0x1F;
-    const Bool_t request2ChInSameSt45 = kTRUE;
-
-    /* CompactMapping* cm = GetCompactMapping(); */
+    std::vector<Int_t> chambers;
 
     for ( std::vector<AliMuonCompactCluster>::size_type i = 0;
             i < track.mClusters.size(); ++i )
@@ -133,7 +133,29 @@ Bool_t AliMuonCompactQuickAccEff::ValidateTrack(const AliMuonCompactTrack& track
             continue;
         }
 
-        currentCh = cl.DetElemId()/100 - 1; 
+        chambers.push_back(cl.DetElemId()/100 - 1);
+    }
+
+    return ValidateChambers(chambers);
+}
+
+Bool_t AliMuonCompactQuickAccEff::ValidateChambers(const std::vector<Int_t>& chambers) const
+{
+    /// Check the station requirements, given the chambers
+    /// of the clusters kept in the track
+
+    Int_t currentCh;
+    Int_t currentSt;
+    Int_t previousCh = -1;
+    Int_t nChHitInSt4 = 0;
+    Int_t nChHitInSt5 = 0;
+    UInt_t presentStationMask = 0;
+    const UInt_t requestedStationMask = 0x1F;
+    const Bool_t request2ChInSameSt45 = kTRUE;
+
+    for ( std::vector<Int_t>::size_type i = 0; i < chambers.size(); ++i )
+    {
+        currentCh = chambers[i];
         currentSt = currentCh/2;
 
         // build present station mask
@@ -258,6 +280,197 @@ TH1* AliMuonCompactQuickAccEff::ComputeMinv(const std::vector<AliMuonCompactEven
     return h;
 }
 
+void AliMuonCompactQuickAccEff::PrepareEvents(const std::vector<AliMuonCompactEvent>& events)
+{
+    /// Flatten the tracks of the events in compact arrays for ComputeNofPairs :
+    /// the chamber of each cluster (computed once), the list of tracks
+    /// having a cluster on each manu, the validity of each track with
+    /// all its clusters and the pairs within the rapidity range
+    /// (which do not depend on the manu status)
+
+    fTrackClusterStart.clear();
+    fClusterBendingManu.clear();
+    fClusterNonBendingManu.clear();
+    fClusterChamber.clear();
+    fTrackValidWithoutBadManu.clear();
+    fManuTrackStart.clear();
+    fManuTracks.clear();
+    fPairs.clear();
+
+    const double m2 = 0.1056584*0.1056584;
+
+    uint64_t maxevents = fMaxEvents;
+    
+    if (!maxevents) { 
+        maxevents = events.size();
+    }
+
+    std::vector<std::pair<Int_t,Int_t> > manuTracks;
+    std::vector<Int_t> chambers;
+    Int_t nManus = 0;
+
+    fTrackClusterStart.push_back(0);
+
+    for ( std::vector<AliMuonCompactEvent>::size_type i = 0;
+             i < maxevents; ++i )
+    {
+        const AliMuonCompactEvent& e = events[i];
+        Int_t firstTrack = fTrackValidWithoutBadManu.size();
+
+        for ( std::vector<AliMuonCompactTrack>::size_type j = 0;
+                j < e.mTracks.size(); ++j ) 
+        {
+            const AliMuonCompactTrack& t1 = e.mTracks[j];
+            Int_t track = fTrackValidWithoutBadManu.size();
+
+            chambers.clear();
+            for ( std::vector<AliMuonCompactCluster>::size_type k = 0;
+                    k < t1.mClusters.size(); ++k )
+            {
+                const AliMuonCompactCluster& cl = t1.mClusters[k];
+                fClusterBendingManu.push_back(cl.BendingManuIndex());
+                fClusterNonBendingManu.push_back(cl.NonBendingManuIndex());
+                fClusterChamber.push_back(cl.DetElemId()/100 - 1);
+                chambers.push_back(fClusterChamber.back());
+                if ( cl.BendingManuIndex() >= 0 )
+                {
+                    manuTracks.push_back(std::make_pair(cl.BendingManuIndex(),track));
+                    nManus = std::max(nManus,cl.BendingManuIndex()+1);
+                }
+                if ( cl.NonBendingManuIndex() >= 0 )
+                {
+                    manuTracks.push_back(std::make_pair(cl.NonBendingManuIndex(),track));
+                    nManus = std::max(nManus,cl.NonBendingManuIndex()+1);
+                }
+            }
+            fTrackClusterStart.push_back(fClusterChamber.size());
+            fTrackValidWithoutBadManu.push_back(ValidateChambers(chambers));
+
+            for ( std::vector<AliMuonCompactTrack>::size_type k = j+1;
+                    k < e.mTracks.size(); ++k )
+            {
+                const AliMuonCompactTrack& t2 = e.mTracks[k];
+
+                // same computation as in ComputeMinv
+                double p1square = t1.mPx*t1.mPx +
+                    t1.mPy*t1.mPy +
+                    t1.mPz*t1.mPz;
+
+                double p2square = t2.mPx*t2.mPx +
+                    t2.mPy*t2.mPy +
+                    t2.mPz*t2.mPz;
+
+                double e = sqrt(m2+p1square+p2square+2.0*sqrt(p1square)*sqrt(p2square));
+                double pz = t1.mPz+t2.mPz;
+
+                double y = 0.5*log( (e+pz) / (e-pz) );
+
+                if (y >= -4 && y <= -2.5 )
+                {
+                    fPairs.push_back(std::make_pair(firstTrack+(Int_t)j,firstTrack+(Int_t)k));
+                }
+            }
+        }
+    }
+
+    // group the tracks by manu (each track only once per manu)
+    std::sort(manuTracks.begin(),manuTracks.end());
+    manuTracks.erase(std::unique(manuTracks.begin(),manuTracks.end()),manuTracks.end());
+
+    fManuTrackStart.assign(nManus+1,0);
+    fManuTracks.reserve(manuTracks.size());
+    for ( std::vector<std::pair<Int_t,Int_t> >::size_type i = 0; i < manuTracks.size(); ++i )
+    {
+        ++fManuTrackStart[manuTracks[i].first+1];
+        fManuTracks.push_back(manuTracks[i].second);
+    }
+    for ( Int_t i = 0; i < nManus; ++i )
+    {
+        fManuTrackStart[i+1] += fManuTrackStart[i];
+    }
+
+    std::cout << Form("Prepared %d tracks with %d clusters on %d manus, %d pairs in rapidity range",
+            (Int_t)fTrackValidWithoutBadManu.size(),(Int_t)fClusterChamber.size(),
+            nManus,(Int_t)fPairs.size()) << std::endl;
+}
+
+Bool_t AliMuonCompactQuickAccEff::ValidatePreparedTrack(Int_t track,
+        const std::vector<UInt_t>& manuStatus,
+        UInt_t causeMask,
+        std::vector<Int_t>& chambers) const
+{
+    /// Same as ValidateTrack, for a track prepared by PrepareEvents
+    /// (chambers is only a work array)
+
+    chambers.clear();
+
+    for ( Int_t i = fTrackClusterStart[track]; i < fTrackClusterStart[track+1]; ++i )
+    {
+        Int_t b = fClusterBendingManu[i];
+        Int_t nb = fClusterNonBendingManu[i];
+        Bool_t bendingIsOK = ( b < 0 || b >= (Int_t)manuStatus.size() || ( manuStatus[b] & causeMask ) == 0 );
+        Bool_t nonBendingIsOK = ( nb < 0 || nb >= (Int_t)manuStatus.size() || ( manuStatus[nb] & causeMask ) == 0 );
+
+        if (!ValidateCluster(b,nb,bendingIsOK,nonBendingIsOK))
+        {
+            continue;
+        }
+
+        chambers.push_back(fClusterChamber[i]);
+    }
+
+    return ValidateChambers(chambers);
+}
+
+Int_t AliMuonCompactQuickAccEff::ComputeNofPairs(const std::vector<UInt_t>& manustatus,
+        UInt_t causeMask)
+{
+    /// Same number of pairs as ComputeMinv, for the events given to PrepareEvents.
+    /// Only the tracks having a cluster on a manu rejected by causeMask
+    /// are validated again, the other ones keep their validity with all clusters
+
+    Int_t nTracks = fTrackValidWithoutBadManu.size();
+    std::vector<Bool_t> valid(nTracks,kTRUE);
+
+    if ( !manustatus.empty() && causeMask != 0 )
+    {
+        valid = fTrackValidWithoutBadManu;
+
+        std::vector<Bool_t> done(nTracks,kFALSE);
+        std::vector<Int_t> chambers;
+        Int_t nManus = std::min((Int_t)manustatus.size(),(Int_t)fManuTrackStart.size()-1);
+
+        for ( Int_t m = 0; m < nManus; ++m )
+        {
+            if ( ( manustatus[m] & causeMask ) == 0 ) continue;
+
+            for ( Int_t i = fManuTrackStart[m]; i < fManuTrackStart[m+1]; ++i )
+            {
+                Int_t track = fManuTracks[i];
+                if ( done[track] ) continue;
+                done[track] = kTRUE;
+                valid[track] = ValidatePreparedTrack(track,manustatus,causeMask,chambers);
+            }
+        }
+    }
+
+    Int_t nValidatedTracks = std::count(valid.begin(),valid.end(),kTRUE);
+    Int_t npairs = 0;
+
+    for ( std::vector<std::pair<Int_t,Int_t> >::size_type i = 0; i < fPairs.size(); ++i )
+    {
+        if ( valid[fPairs[i].first] && valid[fPairs[i].second] )
+        {
+            ++npairs;
+        }
+    }
+
+    std::cout << Form("nTracks %d nValidated %d npairs %d",nTracks,
+            nValidatedTracks,npairs) << std::endl;
+
+    return npairs;
+}
+
 void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompactEvent>& events, 
         std::vector<int>& vrunlist,
         const std::map<int,std::vector<UInt_t> >& manuStatusForRuns,
@@ -288,6 +501,9 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
     // - lv
     // - missing (i.e. buspatch removed from configuration)
 
+    // the per run computations only need the tracks touched by the rejected manus
+    PrepareEvents(events);
+
     std::vector<UInt_t> causes;
 
     causes.push_back(AliMuonCompactManuStatus::MANUOUTOFCONFIGMASK);
@@ -340,22 +556,8 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
                 AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str(),
                 nbad
                 );
-            Int_t npairs(0);
-            TH1* h = ComputeMinv(events,manustatus,causes[icause],npairs);
-            if (h)
-            {
-                h->SetName(Form("hminv%6d%s",runNumber,AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str()));
-                hminv.push_back(h); 
-            }
-            Double_t drop = 0.0;
-            if ( h) 
-            {
-                drop = 100.0*(1.0-h->Integral(b1,b2)/referenceNofJpsi);
-            }
-            else
-            {
-                drop = 100.0*(1.0 - npairs*1.0/referenceNofJpsi);
-            }
+            Int_t npairs = ComputeNofPairs(manustatus,causes[icause]);
+            Double_t drop = 100.0*(1.0 - npairs*1.0/referenceNofJpsi);
             Double_t relativeError = TMath::Sqrt(1.0/npairs + 1.0/referenceNofJpsi);
             Double_t dropError = drop*relativeError;
             std::cout << Form("RUN %6d %30s AccxEff drop %7.2f %% +- %5.2f %%",
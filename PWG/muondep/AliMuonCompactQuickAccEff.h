@@ -4,6 +4,7 @@
 #include "Rtypes.h"
 #include <vector>
 #include <map>
+#include <utility>
 
 class AliMuonCompactCluster;
 class AliMuonCompactEvent;
@@ -50,6 +51,11 @@ class AliMuonCompactQuickAccEff
                 UInt_t causeMask,
                 Int_t& npairs);
 
+        void PrepareEvents(const std::vector<AliMuonCompactEvent>& events);
+
+        Int_t ComputeNofPairs(const std::vector<UInt_t>& manustatus,
+                UInt_t causeMask);
+
         void ComputeEvolutionFromManuStatus(const char* treeFile,
                 const char* runList,
                 const char* outputfile,
@@ -62,8 +68,27 @@ class AliMuonCompactQuickAccEff
         UInt_t GetEvents(const char* treeFile, std::vector<AliMuonCompactEvent>& events, Bool_t verbose=kFALSE);
 
     private:
+        Bool_t ValidateCluster(Int_t bendingManuIndex, Int_t nonBendingManuIndex,
+                Bool_t bendingIsOK, Bool_t nonBendingIsOK) const;
+
+        Bool_t ValidateChambers(const std::vector<Int_t>& chambers) const;
+
+        Bool_t ValidatePreparedTrack(Int_t track,
+                const std::vector<UInt_t>& manuStatus,
+                UInt_t causeMask,
+                std::vector<Int_t>& chambers) const;
+
         ULong64_t fMaxEvents;
         bool fRejectMonoCathodeClusters;
+
+        std::vector<Int_t> fTrackClusterStart; ///< first cluster of each prepared track (one more entry for the end)
+        std::vector<Int_t> fClusterBendingManu; ///< bending manu index of each prepared cluster
+        std::vector<Int_t> fClusterNonBendingManu; ///< non-bending manu index of each prepared cluster
+        std::vector<Int_t> fClusterChamber; ///< chamber of each prepared cluster
+        std::vector<Bool_t> fTrackValidWithoutBadManu; ///< validity of each prepared track with all its clusters
+        std::vector<Int_t> fManuTrackStart; ///< first entry of each manu in fManuTracks (one more entry for the end)
+        std::vector<Int_t> fManuTracks; ///< prepared tracks having a cluster on each manu
+        std::vector<std::pair<Int_t,Int_t> > fPairs; ///< pairs of prepared tracks within the rapidity range
 };
 
 #endif
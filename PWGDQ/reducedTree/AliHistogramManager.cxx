@@ -609,9 +609,16 @@ void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values
     cout << "         Histogram list not filled" << endl; */
     return;
   }
-  if(!hList) {
-    return;
-  }
+  FillHistClass(hList, values);
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(THashList* hList, Float_t* values) {
+  //
+  //  fill a class of histograms, using an already retrieved histogram list
+  //
+  if(!hList) return;
     
   TIter next(hList);
   TObject* h=0x0;
@@ -65,6 +65,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(THashList* hList, Float_t* values);
+  THashList* FindHistClass(const Char_t* className) const {return (THashList*)fMainList.FindObject(className);}    // histogram class lookup, to be cached by callers filling in loops
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -44,7 +44,11 @@ AliMixingHandler::AliMixingHandler() :
   fCentralityVariable(AliReducedVarManager::kNothing),
   fEventVertexVariable(AliReducedVarManager::kNothing),
   fEventPlaneVariable(AliReducedVarManager::kNothing),
-  fHistos(0x0)
+  fHistos(0x0),
+  fHistClassLists(),
+  fLeg1Arrays(),
+  fLeg2Arrays(),
+  fPairArrays()
 {
   // 
   // default constructor
@@ -79,7 +83,11 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title) :
   fCentralityVariable(AliReducedVarManager::kNothing),
   fEventVertexVariable(AliReducedVarManager::kNothing),
   fEventPlaneVariable(AliReducedVarManager::kNothing),
-  fHistos(0x0)
+  fHistos(0x0),
+  fHistClassLists(),
+  fLeg1Arrays(),
+  fLeg2Arrays(),
+  fPairArrays()
 {
   //
   // Named constructor
@@ -136,8 +144,16 @@ void AliMixingHandler::Init() {
   if(histClassArr->GetEntries()!=3*fNParallelCuts) {       // 3 because there is one class of histograms for each pair type: ++,+- and --
     cout << "AliMixingHandler::Init(): ERROR The number of cuts and the number of hist class names provided do not match!" << endl;
     cout << "                   hist classes: " << histClassArr->GetEntries() << ";    n-parallel cuts: " << fNParallelCuts << endl;
+    delete histClassArr;
     return;
   }
+  // cache the histogram lists, such that no lookup by name is needed when filling mixed pairs
+  fHistClassLists.Clear();
+  fHistClassLists.Expand(histClassArr->GetEntries());
+  for(Int_t i=0; i<histClassArr->GetEntries(); ++i)
+    fHistClassLists.AddAt(fHistos->FindHistClass(histClassArr->At(i)->GetName()), i);
+  delete histClassArr;
+  
   Int_t size = (fCentralityLimits.GetSize()-1)*(fEventVertexLimits.GetSize()-1)*(fEventPlaneLimits.GetSize()-1);
   fPoolsLeg1.Expand(size); fPoolsLeg1.SetOwner(kTRUE);
   fPoolsLeg2.Expand(size); fPoolsLeg2.SetOwner(kTRUE);
@@ -391,112 +407,30 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  // build the SoA representation of the pools
+  Float_t m1 = 0.0; Float_t m2 = 0.0;
+  AliReducedVarManager::GetLegMassAssumption(type, m1, m2);
+  BuildLegArrays(leg1Pool, mixingMask, m1, m2, fLeg1Arrays);
+  BuildLegArrays(leg2Pool, mixingMask, m1, m2, fLeg2Arrays);
+  Float_t massSum2 = m1*m1+m2*m2;
   
-  TIter iterEv1Leg1Pool(leg1Pool);
-  TIter iterEv1Leg2Pool(leg2Pool);
-  ULong_t testFlags1 = 0;
-  ULong_t testFlags2 = 0;
   for(Int_t iev1=0; iev1<entries; ++iev1) {                            // first event loop
-    // get the lists of leg1 and leg2 tracks for the first event
-    TList* ev1Leg1List = (TList*)iterEv1Leg1Pool();
-    TList* ev1Leg2List = (TList*)iterEv1Leg2Pool();
-    //cout << "## iev1 " << iev1 << endl;
-    
-    TIter iterEv2Leg1Pool(leg1Pool);
-    TIter iterEv2Leg2Pool(leg2Pool);
     for(Int_t iev2=0; iev2<entries; ++iev2) {                         // second event loop 
-      TList* ev2Leg1List = (TList*)iterEv2Leg1Pool();
-      TList* ev2Leg2List = (TList*)iterEv2Leg2Pool();
       if(iev1==iev2) continue;
-      //cout << "#### iev2 " << iev2 << endl;
-      
-      //loop over the ev1-leg1 list
-      TIter iterLeg1(ev1Leg1List);
-      AliReducedBaseTrack* ev1Leg1=0x0;
-      while((ev1Leg1=(AliReducedBaseTrack*)iterLeg1())) {
-	// check that this track has at least one common bit with the mixing mask
-	testFlags1 = mixingMask & ev1Leg1->GetFlags();
-        //cout << "###### ev1Leg1 (p/px/testFlags1): " << ev1Leg1->P() << "/" << ev1Leg1->Px() << "/";
-        //AliReducedVarManager::PrintBits(testFlags1, fNParallelCuts); cout << endl;
-	if(!testFlags1) continue;
-	
-	//loop over the ev2-leg2 list 
-	TIter iterLeg2(ev2Leg2List);
-	AliReducedBaseTrack* ev2Leg2=0x0;
-	while((ev2Leg2=(AliReducedBaseTrack*)iterLeg2())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg2->GetFlags();
-          //cout << "###### ev2Leg2 (p/px/testFlags1): " << ev2Leg2->P() << "/" << ev2Leg2->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill cross-pairs (leg1 - leg2) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg2, type, values);
-          //cout << "######## cross-pair (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg2 list
-	
-	if(!fMixLikeSign) continue;
-	// loop over the ev2-leg1 list
-	TIter iterLeg1LS(ev2Leg1List);
-	AliReducedBaseTrack* ev2Leg1=0x0;
-	while((ev2Leg1=(AliReducedBaseTrack*)iterLeg1LS())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg1->GetFlags();
-          //cout << "###### ev2Leg1 (p/px/testFlags2): " << ev2Leg1->P() << "/" << ev2Leg1->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill like-pairs (leg1 - leg1) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg1, type, values);
-          //cout << "######## like-pair leg1-leg1 (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg1 list
-      }  // end loop over the ev1-leg1 list
-      
+      // cross-pairs (leg1 - leg2), histogram class index 1
+      MixLegs(fLeg1Arrays, iev1, fLeg2Arrays, iev2, 1, type, massSum2, values);
       if(!fMixLikeSign) continue;
-      //loop over the ev1-leg2 list
-      TIter iterLeg2(ev1Leg2List);
-      AliReducedBaseTrack* ev1Leg2=0x0;
-      while((ev1Leg2=(AliReducedBaseTrack*)iterLeg2())) {
-	// check that this track has at least one common bit with the mixing mask
-	testFlags1 = mixingMask & ev1Leg2->GetFlags();
-        //cout << "###### ev1Leg2 (p/px/testFlags1): " << ev1Leg2->P() << "/" << ev1Leg2->Px() << "/";
-        //AliReducedVarManager::PrintBits(testFlags1, fNParallelCuts); cout << endl;
-	if(!testFlags1) continue;
-	
-	//loop over the ev2-leg2 list 
-	TIter iterLeg2LS(ev2Leg2List);
-	AliReducedBaseTrack* ev2Leg2=0x0;
-	while((ev2Leg2=(AliReducedBaseTrack*)iterLeg2LS())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg2->GetFlags();
-          //cout << "###### ev2Leg2 (p/px/testFlags2): " << ev2Leg2->P() << "/" << ev2Leg2->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill like-pairs (leg2 - leg2) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg2, ev2Leg2, type, values);
-          //cout << "######## like-pair leg2-leg2 (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg2 list
-      }  // end loop over the ev1-leg2 list
+      // like-pairs (leg1 - leg1 and leg2 - leg2), histogram class indices 0 and 2
+      MixLegs(fLeg1Arrays, iev1, fLeg1Arrays, iev2, 0, type, massSum2, values);
+      MixLegs(fLeg2Arrays, iev1, fLeg2Arrays, iev2, 2, type, massSum2, values);
     }  // end second event loop
   }  // end first event loop
   
+  TIter iterEv1Leg1Pool(leg1Pool);
+  TIter iterEv1Leg2Pool(leg2Pool);
+  ULong_t testFlags1 = 0;
+  
   // unset the mixing flags --------------------------------------
-  iterEv1Leg1Pool.Reset(); 
-  iterEv1Leg2Pool.Reset();
   //cout << "Unsetting bits for which mixing was performed" << endl;
   for(Int_t ie1=0; ie1<entries; ++ie1) {
     TList* leg1List = (TList*)iterEv1Leg1Pool();        
@@ -573,6 +507,122 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
 }
 
 
+//_________________________________________________________________________
+void AliMixingHandler::BuildLegArrays(TClonesArray* pool, ULong_t mixingMask, Float_t m1, Float_t m2, AliMixingLegArrays& legs) {
+  //
+  // Copy the kinematics and the cut masks of the legs in a pool into the SoA representation
+  // NOTE: legs without any bit in common with the mixing mask are not copied since they are not used in the mixing
+  //
+  legs.Clear();
+  legs.fEventOffset.reserve(pool->GetEntries()+1);
+  legs.fEventOffset.push_back(0);
+  TIter iterPool(pool);
+  TList* legList = 0x0;
+  while((legList=(TList*)iterPool())) {
+    TIter iterLeg(legList);
+    AliReducedBaseTrack* track=0x0;
+    while((track=(AliReducedBaseTrack*)iterLeg())) {
+      ULong_t mask = mixingMask & track->GetFlags();
+      if(!mask) continue;
+      Float_t p = track->P();
+      legs.fPx.push_back(track->Px());
+      legs.fPy.push_back(track->Py());
+      legs.fPz.push_back(track->Pz());
+      legs.fE1.push_back(TMath::Sqrt(m1*m1+p*p));
+      legs.fE2.push_back(TMath::Sqrt(m2*m2+p*p));
+      legs.fCharge.push_back(track->Charge());
+      legs.fMask.push_back(mask);
+    }
+    legs.fEventOffset.push_back((Int_t)legs.fMask.size());
+  }
+}
+
+
+//_________________________________________________________________________
+Int_t AliMixingHandler::ComputePairBatch(const AliMixingLegArrays& legs1, Int_t leg, const AliMixingLegArrays& legs2, 
+                                         Int_t first, Int_t last, Float_t massSum2, Bool_t computeRapidity) {
+  //
+  // Compute the pair kinematics for the leg "leg" of legs1 combined with the legs in the range [first,last) of legs2
+  // NOTE: The loops run over plain arrays without branches such that they can be vectorized by the compiler
+  //       Negative squared masses, which can appear due to the Float_t precision, are set to zero
+  //
+  Int_t n = last-first;
+  if(n<=0) return 0;
+  fPairArrays.Resize(n);
+  
+  const Float_t px1 = legs1.fPx[leg];
+  const Float_t py1 = legs1.fPy[leg];
+  const Float_t pz1 = legs1.fPz[leg];
+  const Float_t e1 = legs1.fE1[leg];
+  const ULong_t mask1 = legs1.fMask[leg];
+  const Float_t* px2 = &legs2.fPx[first];
+  const Float_t* py2 = &legs2.fPy[first];
+  const Float_t* pz2 = &legs2.fPz[first];
+  const Float_t* e2 = &legs2.fE2[first];
+  const ULong_t* mask2 = &legs2.fMask[first];
+  Float_t* px = &fPairArrays.fPx[0];
+  Float_t* py = &fPairArrays.fPy[0];
+  Float_t* pz = &fPairArrays.fPz[0];
+  Float_t* pt = &fPairArrays.fPt[0];
+  Float_t* mass = &fPairArrays.fMass[0];
+  Float_t* rap = &fPairArrays.fRapidity[0];
+  ULong_t* mask = &fPairArrays.fMask[0];
+  
+  for(Int_t i=0; i<n; ++i) {
+    mask[i] = mask1 & mask2[i];
+    px[i] = px1 + px2[i];
+    py[i] = py1 + py2[i];
+    pz[i] = pz1 + pz2[i];
+    pt[i] = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    Float_t m2 = massSum2 + 2.0f*(e1*e2[i] - px1*px2[i] - py1*py2[i] - pz1*pz2[i]);
+    mass[i] = TMath::Sqrt(m2>0.0f ? m2 : 0.0f);
+  }
+  if(computeRapidity) {
+    for(Int_t i=0; i<n; ++i) {
+      Float_t e = e1 + e2[i];
+      rap[i] = (e-TMath::Abs(pz[i])>1.0e-10 ? 0.5f*TMath::Log((e+pz[i])/(e-pz[i])) : -999.f);
+    }
+  }
+  return n;
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::MixLegs(const AliMixingLegArrays& legs1, Int_t ev1, const AliMixingLegArrays& legs2, Int_t ev2, 
+                               Int_t pairTypeIdx, Int_t type, Float_t massSum2, Float_t* values) {
+  //
+  // Mix the legs of event ev1 from legs1 with the legs of event ev2 from legs2
+  // pairTypeIdx is the index of the histogram class for each cut: 0 (leg1-leg1), 1 (leg1-leg2), 2 (leg2-leg2)
+  // The histograms are filled only for the cuts fulfilled by both legs, so the cost scales with the number of pairs
+  //
+  Int_t first = legs2.fEventOffset[ev2];
+  Int_t last = legs2.fEventOffset[ev2+1];
+  if(first==last) return;
+  Bool_t computeRapidity = AliReducedVarManager::GetUsedVar(AliReducedVarManager::kRap);
+  
+  for(Int_t leg=legs1.fEventOffset[ev1]; leg<legs1.fEventOffset[ev1+1]; ++leg) {
+    Int_t n = ComputePairBatch(legs1, leg, legs2, first, last, massSum2, computeRapidity);
+    for(Int_t i=0; i<n; ++i) {
+      ULong_t mask = fPairArrays.fMask[i];
+      if(!mask) continue;
+      Int_t charge1 = legs1.fCharge[leg];
+      Int_t charge2 = legs2.fCharge[first+i];
+      Int_t pairType = 2;
+      if(charge1*charge2<0) pairType = 1;
+      else if(charge1>0)    pairType = 0;
+      AliReducedVarManager::FillPairInfoME(fPairArrays.fPx[i], fPairArrays.fPy[i], fPairArrays.fPz[i], fPairArrays.fPt[i], 
+                                           fPairArrays.fMass[i], (computeRapidity ? fPairArrays.fRapidity[i] : -999.f),
+                                           pairType, type, values);
+      // loop only up to the highest cut bit fulfilled by this pair
+      for(Int_t ibit=0; mask; ++ibit, mask>>=1) {
+        if(mask & ULong_t(1))
+          fHistos->FillHistClass((THashList*)fHistClassLists.At(ibit*3+pairTypeIdx), values);
+      }
+    }
+  }
+}
+
+
 //_________________________________________________________________________
 void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
   //
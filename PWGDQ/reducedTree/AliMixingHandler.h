@@ -13,10 +13,44 @@
 #include <TClonesArray.h>
 #include <TList.h>
 #include <TString.h>
+#include <TObjArray.h>
+
+#include <vector>
 
 #include "AliHistogramManager.h"
 #include "AliReducedVarManager.h"
 
+//_________________________________________________________________________
+// Structure of arrays representation of the leg lists in a pool of events.
+// The legs of event i are stored in the index range [fEventOffset[i], fEventOffset[i+1])
+// Only legs having at least one cut bit in common with the mixing mask are stored
+struct AliMixingLegArrays {
+  std::vector<Float_t> fPx;
+  std::vector<Float_t> fPy;
+  std::vector<Float_t> fPz;
+  std::vector<Float_t> fE1;            // energy with the mass assumption for the first pair leg
+  std::vector<Float_t> fE2;            // energy with the mass assumption for the second pair leg
+  std::vector<Int_t>   fCharge;
+  std::vector<ULong_t> fMask;          // cut membership mask (already and-ed with the mixing mask)
+  std::vector<Int_t>   fEventOffset;
+  
+  void Clear() {fPx.clear(); fPy.clear(); fPz.clear(); fE1.clear(); fE2.clear(); fCharge.clear(); fMask.clear(); fEventOffset.clear();}
+};
+
+//_________________________________________________________________________
+// Kinematics of a batch of pairs, computed by AliMixingHandler::ComputePairBatch()
+struct AliMixingPairArrays {
+  std::vector<Float_t> fPx;
+  std::vector<Float_t> fPy;
+  std::vector<Float_t> fPz;
+  std::vector<Float_t> fPt;
+  std::vector<Float_t> fMass;
+  std::vector<Float_t> fRapidity;
+  std::vector<ULong_t> fMask;          // cuts fulfilled by both legs
+  
+  void Resize(Int_t n) {fPx.resize(n); fPy.resize(n); fPz.resize(n); fPt.resize(n); fMass.resize(n); fRapidity.resize(n); fMask.resize(n);}
+};
+
 class AliMixingHandler : public TNamed {
 
 public:
@@ -84,7 +118,17 @@ private:
   AliReducedVarManager::Variables fEventPlaneVariable;
   
   AliHistogramManager* fHistos;    // histogram manager
+  TObjArray fHistClassLists;       //! histogram lists for each cut and pair type (same ordering as in fHistClassNames)
+  
+  AliMixingLegArrays fLeg1Arrays;  //! leg1 pool in SoA format, rebuilt for every mixing
+  AliMixingLegArrays fLeg2Arrays;  //! leg2 pool in SoA format, rebuilt for every mixing
+  AliMixingPairArrays fPairArrays; //! pair kinematics for the current batch
   
+  void BuildLegArrays(TClonesArray* pool, ULong_t mixingMask, Float_t m1, Float_t m2, AliMixingLegArrays& legs);
+  Int_t ComputePairBatch(const AliMixingLegArrays& legs1, Int_t leg, const AliMixingLegArrays& legs2, Int_t first, Int_t last, 
+                         Float_t massSum2, Bool_t computeRapidity);
+  void MixLegs(const AliMixingLegArrays& legs1, Int_t ev1, const AliMixingLegArrays& legs2, Int_t ev2, 
+               Int_t pairTypeIdx, Int_t type, Float_t massSum2, Float_t* values);
   void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
@@ -154,7 +154,7 @@ void AliReducedAnalysisFilterTrees::Process() {
      fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
       fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
   }
   
@@ -168,7 +168,7 @@ void AliReducedAnalysisFilterTrees::Process() {
      fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
      fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
   }
   
@@ -207,7 +207,7 @@ void AliReducedAnalysisFilterTrees::WriteFilteredPairs() {
    TIter nextPair(pairList);
    for(Int_t ip=0; ip<fEvent->NPairs(); ++ip) {
       pair = (AliReducedPairInfo*)nextPair();
-      AliReducedVarManager::FillPairInfo(pair, fValues);
+      AliReducedVarManager::FillPairInfo(pair, fValues, fEvent);
       fHistosManager->FillHistClass("Pair_BeforeCuts", fValues);
       for(UShort_t iflag=0; iflag<32; ++iflag) {
          AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
@@ -243,7 +243,7 @@ void AliReducedAnalysisFilterTrees::WriteFilteredTracks() {
    TIter nextTrack(trackList);
    for(Int_t it=0; it<fEvent->NTracks(); ++it) {
       track = (AliReducedBaseTrack*)nextTrack();
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
       
       Bool_t writeTrack = IsTrackSelected(track, fValues);
@@ -303,7 +303,7 @@ void AliReducedAnalysisFilterTrees::RunCandidateLegsSelection() {
    for(Int_t it=0; it<fEvent->NTracks(); ++it) {
       track = (AliReducedBaseTrack*)nextTrack();
       
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       if(isAsymmetricDecayChannel) {
          if(IsCandidateLegSelected(track, fValues, 1)) {
             fLeg1Tracks.Add(track);
@@ -40,7 +40,9 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fPosTracks(),
   fNegTracks(),
   fPrefilterPosTracks(),
-  fPrefilterNegTracks()
+  fPrefilterNegTracks(),
+  fPairHistClassesPrefix(""),
+  fPairHistClassLists()
 {
   //
   // default constructor
@@ -66,7 +68,9 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fPosTracks(),
   fNegTracks(),
   fPrefilterPosTracks(),
-  fPrefilterNegTracks()
+  fPrefilterNegTracks(),
+  fPairHistClassesPrefix(""),
+  fPairHistClassLists()
 {
   //
   // named constructor
@@ -235,7 +239,7 @@ void AliReducedAnalysisJpsi2ee::Process() {
      fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
       fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
   }
   
@@ -284,7 +288,7 @@ void AliReducedAnalysisJpsi2ee::Process() {
      fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
      fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
   }
 }
@@ -302,7 +306,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       track = (AliReducedTrackInfo*)nextPosTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       FillTrackHistograms(track, trackClass);
    }
    TIter nextNegTrack(&fNegTracks);
@@ -310,7 +314,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       track = (AliReducedTrackInfo*)nextNegTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       FillTrackHistograms(track, trackClass);
       //cout << "Neg track " << i << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
    }
@@ -352,13 +356,25 @@ void AliReducedAnalysisJpsi2ee::FillPairHistograms(ULong_t mask, Int_t pairType,
    //
    // fill pair level histograms
    // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
-   TString typeStr[3] = {"PP", "PM", "MM"};
-   for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
-      if(mask & (ULong_t(1)<<icut)) {
-         fHistosManager->FillHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth && pairType==1) fHistosManager->FillHistClass(Form("%s%s_%s_MCTruth", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
+   //       The histogram lists are looked up once per pair class and cached, and only the cuts with bits toggled in the mask are visited
+   if(pairClass.CompareTo(fPairHistClassesPrefix) || fPairHistClassLists.GetSize()!=6*fTrackCuts.GetEntries()) {
+      TString typeStr[3] = {"PP", "PM", "MM"};
+      fPairHistClassesPrefix = pairClass;
+      fPairHistClassLists.Clear();
+      fPairHistClassLists.Expand(6*fTrackCuts.GetEntries());
+      for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
+         for(Int_t itype=0; itype<3; ++itype) {
+            fPairHistClassLists.AddAt(fHistosManager->FindHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[itype].Data(), fTrackCuts.At(icut)->GetName())), 6*icut+itype);
+            fPairHistClassLists.AddAt(fHistosManager->FindHistClass(Form("%s%s_%s_MCTruth", pairClass.Data(), typeStr[itype].Data(), fTrackCuts.At(icut)->GetName())), 6*icut+3+itype);
+         }
       }
-         
+   }
+   
+   if(fTrackCuts.GetEntries()<64) mask &= (ULong_t(1)<<fTrackCuts.GetEntries())-1;
+   for(Int_t icut=0; mask; ++icut, mask>>=1) {
+      if(!(mask & ULong_t(1))) continue;
+      fHistosManager->FillHistClass((THashList*)fPairHistClassLists.At(6*icut+pairType), fValues);
+      if(isMCTruth && pairType==1) fHistosManager->FillHistClass((THashList*)fPairHistClassLists.At(6*icut+3+pairType), fValues);
    }  // end loop over cuts
 }
 
@@ -381,7 +397,7 @@ void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
       track = (AliReducedTrackInfo*)nextTrack();
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
       //cout << "track " << it << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          //cout << "track / tracking flags :: " << track << " / "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
@@ -6,6 +6,7 @@
 #define ALIREDUCEDANALYSISJPSI2EE_H
 
 #include <TList.h>
+#include <TObjArray.h>
 
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedInfoCut.h"
@@ -78,6 +79,9 @@ protected:
    TList fPrefilterPosTracks;  // list of prefilter selected positive tracks in the current event
    TList fPrefilterNegTracks; // list of prefilter selected negative tracks in the current event
    
+   TString fPairHistClassesPrefix;   //! pair class for which the pair histogram lists are cached
+   TObjArray fPairHistClassLists;    //! cached pair histogram lists, 6 per track cut: PP, PM, MM, PP_MCTruth, PM_MCTruth, MM_MCTruth
+   
   Bool_t IsEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
   Bool_t IsTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
   Bool_t IsTrackPrefilterSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
@@ -237,7 +237,7 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
      fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
       fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
   }
   
@@ -286,7 +286,7 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
      fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
-     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
      fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
   }
 }
@@ -304,7 +304,7 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       track = (AliReducedTrackInfo*)nextPosTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       FillTrackHistograms(track, Form("%s+", trackClass.Data()) );
       FillTrackHistograms(track, Form("%s", trackClass.Data()) );
    }
@@ -313,7 +313,7 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       track = (AliReducedTrackInfo*)nextNegTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       FillTrackHistograms(track, Form("%s-", trackClass.Data()) );
       FillTrackHistograms(track, Form("%s", trackClass.Data()) );
       //cout << "Neg track " << i << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
@@ -385,7 +385,7 @@ void AliReducedAnalysisJpsi2eeMult::RunTrackSelection() {
       track = (AliReducedTrackInfo*)nextTrack();
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
       //cout << "track " << it << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          //cout << "track / tracking flags :: " << track << " / "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
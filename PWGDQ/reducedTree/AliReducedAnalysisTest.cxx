@@ -132,7 +132,7 @@ void AliReducedAnalysisTest::Process() {
   fHistosManager->FillHistClass("Event_NoCuts", fValues);
   if(fEvent->IsA()==AliReducedEventInfo::Class()) {
     for(UShort_t ibit=0; ibit<64; ++ibit) {
-      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
       fHistosManager->FillHistClass("OnlineTriggers_NoCuts", fValues);
     }
   }
@@ -143,7 +143,7 @@ void AliReducedAnalysisTest::Process() {
   
   if(eventInfo) {
     for(UShort_t ibit=0; ibit<64; ++ibit) {
-      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
+      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, fEvent);
       fHistosManager->FillHistClass("OnlineTriggers_AfterCuts", fValues);
       for(UShort_t i=0; i<32; ++i) {
         AliReducedVarManager::FillL0TriggerInputs(eventInfo, i, fValues);
@@ -193,7 +193,7 @@ void AliReducedAnalysisTest::Process() {
       track = (AliReducedBaseTrack*)nextTrack();
     
       if(!IsTrackSelected(track)) continue;
-      AliReducedVarManager::FillTrackInfo(track,fValues);
+      AliReducedVarManager::FillTrackInfo(track, fValues, fEvent);
       fHistosManager->FillHistClass("TrackQA_AllTracks", fValues);
     
       AliReducedTrackInfo* trackInfo = NULL;
@@ -274,7 +274,7 @@ void AliReducedAnalysisTest::Process() {
       }
       TString type[3]={"PP","PM","MM"};
       
-      AliReducedVarManager::FillPairInfo(pair, fValues);
+      AliReducedVarManager::FillPairInfo(pair, fValues, fEvent);
       switch (pair->CandidateId()) {
         case AliReducedPairInfo::kGammaConv :
           fHistosManager->FillHistClass(Form("PairQA_%sGamma",pairTypeStr.Data()),fValues);
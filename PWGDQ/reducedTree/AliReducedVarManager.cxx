@@ -27,6 +27,7 @@ using std::ifstream;
 #include <TProfile2D.h>
 #include <TFile.h>
 #include <THashList.h>
+#include <TVirtualMutex.h>
 
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
@@ -114,6 +115,11 @@ TString AliReducedVarManager::fgVariableUnits[AliReducedVarManager::kNVars] = {"
 AliReducedBaseEvent* AliReducedVarManager::fgEvent = 0x0;
 AliReducedEventPlaneInfo* AliReducedVarManager::fgEventPlane = 0x0;
 Bool_t AliReducedVarManager::fgUsedVars[AliReducedVarManager::kNVars] = {kFALSE};
+Bool_t AliReducedVarManager::fgUsedVarBlocks[AliReducedVarManager::kNVarBlocks] = {kFALSE};
+std::vector<Int_t> AliReducedVarManager::fgVarDependencies[AliReducedVarManager::kNVars];
+Bool_t AliReducedVarManager::fgVarDependenciesCompiled = kFALSE;
+Float_t AliReducedVarManager::fgRunWiseValues[AliReducedVarManager::kNRunWiseVariables] = {0.0};
+TVirtualMutex* AliReducedVarManager::fgRunInfoMutex = 0x0;
 TH2F* AliReducedVarManager::fgTPCelectronCentroidMap = 0x0;
 TH2F* AliReducedVarManager::fgTPCelectronWidthMap = 0x0;
 AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyX = kNothing;
@@ -175,129 +181,147 @@ AliReducedVarManager::~AliReducedVarManager() {
 }
 
 //__________________________________________________________________
-void AliReducedVarManager::SetVariableDependencies() {
+void AliReducedVarManager::AddVariableDependency(Int_t var, Int_t dependency) {
   //
-  // Set as used those variables on which other variables calculation depends
+  // Add an edge var -> dependency to the variable dependency graph
   //
-  if(fgUsedVars[kDeltaVtxZ]) {
-    fgUsedVars[kVtxZ] = kTRUE;
-    fgUsedVars[kVtxZtpc] = kTRUE;
-  }
-  if(fgUsedVars[kRap]) {
-    fgUsedVars[kMass] = kTRUE;
-    fgUsedVars[kP] = kTRUE;
-  }
-  if(fgUsedVars[kEta]) fgUsedVars[kP] = kTRUE;
+  if(var<=kNothing || var>=kNVars) return;
+  if(dependency<=kNothing || dependency>=kNVars) return;
+  for(UInt_t i=0; i<fgVarDependencies[var].size(); ++i)
+    if(fgVarDependencies[var][i]==dependency) return;
+  fgVarDependencies[var].push_back(dependency);
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::CompileVariableDependencies() {
+  //
+  // Build the graph of variables on which other variables calculation depends.
+  // This is done only once; using a variable afterwards just walks the graph.
+  //
+  if(fgVarDependenciesCompiled) return;
+  fgVarDependenciesCompiled = kTRUE;
+  
+  AddVariableDependency(kDeltaVtxZ, kVtxZ);
+  AddVariableDependency(kDeltaVtxZ, kVtxZtpc);
+  AddVariableDependency(kRap, kMass);
+  AddVariableDependency(kRap, kP);
+  AddVariableDependency(kEta, kP);
   
   for(Int_t ih=0; ih<6; ++ih) {
-    if(fgUsedVars[kVZEROQvecX+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-    }
-    if(fgUsedVars[kVZEROQvecY+2*6+ih]) {
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
-    }
-    if(fgUsedVars[kVZERORP+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
-    }
-    if(fgUsedVars[kVZEROQaQcSP+ih] || fgUsedVars[kVZEROQaQcSPsine+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih]    = kTRUE; fgUsedVars[kVZERORP+1*6+ih]    = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
-    }
-    if(fgUsedVars[kRPXtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
-    }
-    if(fgUsedVars[kRPXtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
-    }
-    if(fgUsedVars[kRPYtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
-    }
-    if(fgUsedVars[kRPYtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
-    }  
-    if(fgUsedVars[kRPXtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
-    }  
-    if(fgUsedVars[kRPXtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
-    }  
-    if(fgUsedVars[kRPYtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
-    }  
-    if(fgUsedVars[kRPYtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
-    }  
-    if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
-    }
-    if(fgUsedVars[kRPdeltaVZEROCtpc+ih]) {
-      fgUsedVars[kVZERORP+1*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
-    }
-    if(fgUsedVars[kTPCsubResCos+ih]) {
-      fgUsedVars[kTPCRPleft+ih] = kTRUE; fgUsedVars[kTPCRPright+ih] = kTRUE;
+    for(Int_t iside=0; iside<2; ++iside) {
+      AddVariableDependency(kVZEROQvecX+2*6+ih, kVZEROQvecX+iside*6+ih);
+      AddVariableDependency(kVZEROQvecY+2*6+ih, kVZEROQvecY+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSP+ih, kVZERORP+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSP+ih, kVZEROQvecX+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSP+ih, kVZEROQvecY+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSPsine+ih, kVZERORP+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSPsine+ih, kVZEROQvecX+iside*6+ih);
+      AddVariableDependency(kVZEROQaQcSPsine+ih, kVZEROQvecY+iside*6+ih);
     }
+    AddVariableDependency(kVZERORP+2*6+ih, kVZEROQvecX+2*6+ih);
+    AddVariableDependency(kVZERORP+2*6+ih, kVZEROQvecY+2*6+ih);
+    
+    AddVariableDependency(kRPXtpcXvzeroa+ih, kTPCQvecX+ih); AddVariableDependency(kRPXtpcXvzeroa+ih, kVZEROQvecX+ih);
+    AddVariableDependency(kRPXtpcXvzeroc+ih, kTPCQvecX+ih); AddVariableDependency(kRPXtpcXvzeroc+ih, kVZEROQvecX+6+ih);
+    AddVariableDependency(kRPYtpcYvzeroa+ih, kTPCQvecY+ih); AddVariableDependency(kRPYtpcYvzeroa+ih, kVZEROQvecY+ih);
+    AddVariableDependency(kRPYtpcYvzeroc+ih, kTPCQvecY+ih); AddVariableDependency(kRPYtpcYvzeroc+ih, kVZEROQvecY+6+ih);
+    AddVariableDependency(kRPXtpcYvzeroa+ih, kTPCQvecX+ih); AddVariableDependency(kRPXtpcYvzeroa+ih, kVZEROQvecY+ih);
+    AddVariableDependency(kRPXtpcYvzeroc+ih, kTPCQvecX+ih); AddVariableDependency(kRPXtpcYvzeroc+ih, kVZEROQvecY+6+ih);
+    AddVariableDependency(kRPYtpcXvzeroa+ih, kTPCQvecY+ih); AddVariableDependency(kRPYtpcXvzeroa+ih, kVZEROQvecX+ih);
+    AddVariableDependency(kRPYtpcXvzeroc+ih, kTPCQvecY+ih); AddVariableDependency(kRPYtpcXvzeroc+ih, kVZEROQvecX+6+ih);
+    AddVariableDependency(kRPdeltaVZEROAtpc+ih, kVZERORP+0*6+ih); AddVariableDependency(kRPdeltaVZEROAtpc+ih, kTPCRP+ih);
+    AddVariableDependency(kRPdeltaVZEROCtpc+ih, kVZERORP+1*6+ih); AddVariableDependency(kRPdeltaVZEROCtpc+ih, kTPCRP+ih);
+    AddVariableDependency(kTPCsubResCos+ih, kTPCRPleft+ih); AddVariableDependency(kTPCsubResCos+ih, kTPCRPright+ih);
+    
     for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
-      if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
-	 fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
-	fgUsedVars[kPhi] = kTRUE; fgUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
-	if(iVZEROside<2 && (fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
-	  fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
-	}
+      Int_t flowVars[4] = {kVZEROFlowVn+iVZEROside*6+ih, kVZEROFlowSine+iVZEROside*6+ih, 
+                           kVZEROuQ+iVZEROside*6+ih, kVZEROuQsine+iVZEROside*6+ih};
+      // the u*Q variables exist only for the A and C sides
+      Int_t nFlowVars = (iVZEROside<2 ? 4 : 2);
+      for(Int_t iv=0; iv<nFlowVars; ++iv) {
+        AddVariableDependency(flowVars[iv], kPhi);
+        AddVariableDependency(flowVars[iv], kVZERORP+iVZEROside*6+ih);
+        if(iv>=2 || iVZEROside==2) {
+          for(Int_t iside=0; iside<2; ++iside) {
+            AddVariableDependency(flowVars[iv], kVZEROQvecX+iside*6+ih);
+            AddVariableDependency(flowVars[iv], kVZEROQvecY+iside*6+ih);
+          }
+        }
         if(iVZEROside==2) {
-	  fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
-	}
+          AddVariableDependency(flowVars[iv], kVZEROQvecX+2*6+ih);
+          AddVariableDependency(flowVars[iv], kVZEROQvecY+2*6+ih);
+        }
       }
     }
-    if(fgUsedVars[kTPCFlowVn+ih] || fgUsedVars[kTPCFlowSine+ih] || fgUsedVars[kTPCuQ+ih] || fgUsedVars[kTPCuQsine+ih]) {
-      fgUsedVars[kPhi] = kTRUE;
-      fgUsedVars[kTPCQvecXtotal+ih] = kTRUE;
-      fgUsedVars[kTPCQvecYtotal+ih] = kTRUE;
+    Int_t tpcFlowVars[4] = {kTPCFlowVn+ih, kTPCFlowSine+ih, kTPCuQ+ih, kTPCuQsine+ih};
+    for(Int_t iv=0; iv<4; ++iv) {
+      AddVariableDependency(tpcFlowVars[iv], kPhi);
+      AddVariableDependency(tpcFlowVars[iv], kTPCQvecXtotal+ih);
+      AddVariableDependency(tpcFlowVars[iv], kTPCQvecYtotal+ih);
     }
-   
   } // end loop over harmonics
   for(Int_t ich=0; ich<64; ++ich) {
-    if(fgUsedVars[kVZEROflowV2TPC+ich]) {
-      fgUsedVars[kVZEROChannelMult+ich] = kTRUE; fgUsedVars[kTPCRP+1] = kTRUE;
+    AddVariableDependency(kVZEROflowV2TPC+ich, kVZEROChannelMult+ich);
+    AddVariableDependency(kVZEROflowV2TPC+ich, kTPCRP+1);
+  }
+  AddVariableDependency(kPtSquared, kPt);
+  AddVariableDependency(kTPCnSigCorrected+kElectron, kTPCnSig+kElectron);
+  AddVariableDependency(kTPCnSigCorrected+kElectron, fgVarDependencyX);
+  AddVariableDependency(kTPCnSigCorrected+kElectron, fgVarDependencyY);
+  AddVariableDependency(kPairEff, fgEffMapVarDependencyX);
+  AddVariableDependency(kPairEff, fgEffMapVarDependencyY);
+  AddVariableDependency(kOneOverPairEff, fgEffMapVarDependencyX);
+  AddVariableDependency(kOneOverPairEff, fgEffMapVarDependencyY);
+  AddVariableDependency(kNTracksITSoutVsSPDtracklets, GetMultiplicityEstimator(kSPDntracklets10));
+  AddVariableDependency(kNTracksTPCoutVsSPDtracklets, GetMultiplicityEstimator(kSPDntracklets10));
+  AddVariableDependency(kNTracksTOFoutVsSPDtracklets, GetMultiplicityEstimator(kSPDntracklets10));
+  AddVariableDependency(kNTracksTRDoutVsSPDtracklets, GetMultiplicityEstimator(kSPDntracklets10));
+  AddVariableDependency(kRapMC, kMassMC);
+  AddVariableDependency(kPairPhiV, kL3Polarity);
+  AddVariableDependency(kMassDcaPtCorr, kMass);
+  AddVariableDependency(kMassDcaPtCorr, kPt);
+  AddVariableDependency(kMassDcaPtCorr, kPairDcaXYSqrt);
+  AddVariableDependency(kOpAngDcaPtCorr, kPairOpeningAngle);
+  AddVariableDependency(kOpAngDcaPtCorr, kOneOverSqrtPt);
+  AddVariableDependency(kOpAngDcaPtCorr, kPt);
+  AddVariableDependency(kOpAngDcaPtCorr, kPairDcaXYSqrt);
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::UseVariable(Int_t var) {
+  //
+  // Flag a variable as used, together with all the variables it depends on (transitive closure
+  // over the precompiled dependency graph) and the detector block it belongs to
+  //
+  if(var<=kNothing || var>=kNVars) return;
+  CompileVariableDependencies();
+  
+  std::vector<Int_t> stack(1, var);
+  while(!stack.empty()) {
+    Int_t current = stack.back();
+    stack.pop_back();
+    if(fgUsedVars[current] && current!=var) continue;
+    fgUsedVars[current] = kTRUE;
+    Int_t block = GetVariableBlock(current);
+    if(block>=0) fgUsedVarBlocks[block] = kTRUE;
+    for(UInt_t i=0; i<fgVarDependencies[current].size(); ++i) {
+      Int_t dependency = fgVarDependencies[current][i];
+      if(!fgUsedVars[dependency]) stack.push_back(dependency);
     }
   }
-  if(fgUsedVars[kPtSquared]) fgUsedVars[kPt]=kTRUE;  
-  if(fgUsedVars[kTPCnSigCorrected+kElectron]) {
-     fgUsedVars[kTPCnSig+kElectron] = kTRUE; 
-     fgUsedVars[fgVarDependencyX] = kTRUE; 
-     fgUsedVars[fgVarDependencyY] = kTRUE;
-  }
-  if(fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff]){
-    fgUsedVars[fgEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyY] = kTRUE;
-  }
-  if(fgUsedVars[kNTracksITSoutVsSPDtracklets] || fgUsedVars[kNTracksTPCoutVsSPDtracklets] ||
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] || fgUsedVars[kNTracksTRDoutVsSPDtracklets])
-     fgUsedVars[GetMultiplicityEstimator(kSPDntracklets10)] = kTRUE;
-  
-  if(fgUsedVars[kRapMC]) fgUsedVars[kMassMC] = kTRUE;
+}
 
-  if(fgUsedVars[kPairPhiV]){
-    fgUsedVars[kL3Polarity] = kTRUE;
-  }
-  if(fgUsedVars[kMassDcaPtCorr] ) {
-    fgUsedVars[kMass]          = kTRUE;
-    fgUsedVars[kPt]            = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt] = kTRUE;
-  }
-  if(fgUsedVars[kOpAngDcaPtCorr] ) {
-    fgUsedVars[kPairOpeningAngle] = kTRUE;
-    fgUsedVars[kOneOverSqrtPt]    = kTRUE;
-    fgUsedVars[kPt]               = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt]    = kTRUE;
-  }
+//__________________________________________________________________
+Int_t AliReducedVarManager::GetVariableBlock(Int_t var) {
+  //
+  // Return the detector block which needs to be filled for a given variable, or -1
+  //
+  if(var>=kVZEROAemptyChannels && var<kVZEROQvecX) return kVZEROChannelBlock;
+  if(var>=kVZEROQvecX && var<kZDCnEnergyCh) return kEventPlaneBlock;
+  if(var>=kZDCnEnergyCh && var<=kTZEROsatellite) return kZDCTZEROBlock;
+  if(var>=kTRDntracklets && var<kEMCALmatchedEnergy) return kTRDBlock;
+  if(var>=kEMCALmatchedEnergy && var<=kEMCALdispersion) return kCaloBlock;
+  return -1;
 }
 
 //__________________________________________________________________
@@ -308,6 +332,106 @@ void AliReducedVarManager::FillEventInfo(Float_t* values) {
   FillEventInfo(fgEvent, values, fgEventPlane);
 }
 
+//__________________________________________________________________
+void AliReducedVarManager::UpdateRunWiseInfo(Int_t runNo) {
+  //
+  // Load the run wise information (GRP, LHC data, calibrations) for a new run.
+  // The values are cached and copied into every values buffer by FillEventInfo()
+  // Must be called with fgRunInfoMutex locked
+  //
+  for(Int_t i=0; i<kNRunWiseVariables; ++i) fgRunWiseValues[i] = 0.0;
+  // GRP and LHC information
+  if(fgRunTotalLuminosity) fgRunWiseValues[kTotalLuminosity] = fgRunTotalLuminosity->GetBinContent(fgRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunTotalIntensity0) fgRunWiseValues[kBeamIntensity0] = fgRunTotalIntensity0->GetBinContent(fgRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunTotalIntensity1) fgRunWiseValues[kBeamIntensity1] = fgRunTotalIntensity1->GetBinContent(fgRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunLHCFillNumber) fgRunWiseValues[kLHCFillNumber] = fgRunLHCFillNumber->GetBinContent(fgRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunDipolePolarity) fgRunWiseValues[kDipolePolarity] = fgRunDipolePolarity->GetBinContent(fgRunDipolePolarity->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunL3Polarity) fgRunWiseValues[kL3Polarity] = fgRunL3Polarity->GetBinContent(fgRunL3Polarity->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunTimeStart) fgRunWiseValues[kRunTimeStart] = fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",runNo)));
+  if(fgRunTimeEnd) fgRunWiseValues[kRunTimeEnd] = fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",runNo)));
+  
+  // VZERO calibration
+  if(fgVZEROCalibrationPath.Data()[0]!='\0') {
+     cout << "AliReducedVarManager::Info  Attempting to load VZERO calibration and/or recentering histograms from path: " << endl << fgVZEROCalibrationPath.Data() << endl;
+    TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", fgVZEROCalibrationPath.Data(), runNo));
+    THashList* mainList = (THashList*)calibFile->Get("jpsi2eeHistos");
+    THashList* calibList = (THashList*)mainList->FindObject("Event_AfterCuts");
+    if(!calibList) {
+       cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << runNo << endl;
+       cout << "                        Will run uncalibrated and not-recentered!" << endl;
+       fgOptionCalibrateVZEROqVec = kFALSE;
+       fgOptionRecenterVZEROqVec = kFALSE;
+    }
+    cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << runNo << endl;
+    if(fgOptionCalibrateVZEROqVec) {
+      for(Int_t iCh=0; iCh<64; ++iCh) {
+         
+         fgAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", runNo, iCh));
+         fgAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
+      }
+    }
+    if(fgOptionRecenterVZEROqVec) {
+       fgVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", runNo));
+       fgVZEROqVecRecentering[0]->SetDirectory(0x0);
+       fgVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", runNo));
+       fgVZEROqVecRecentering[1]->SetDirectory(0x0);
+       fgVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", runNo));
+       fgVZEROqVecRecentering[2]->SetDirectory(0x0);
+       fgVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", runNo));
+       fgVZEROqVecRecentering[3]->SetDirectory(0x0);
+    }
+    calibFile->Close();
+  }
+
+  if(fgUsedVars[kRunID]){
+    if( fgRunID < 0 ){
+      for( fgRunID = 0; fgRunNumbers[ fgRunID ] != runNo && fgRunID< fgRunNumbers.size() ; ++fgRunID );
+    }
+  }
+  for( int iEstimator =0 ; iEstimator < kNMultiplicityEstimators ; ++iEstimator ){
+    if( fgAvgMultVsVtxAndRun[iEstimator] ){
+      Bool_t fillGlobal = !fgAvgMultVsVtxGlobal[iEstimator];
+      fgAvgMultVsVtxRunwise  [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileY( Form("AvgMultVsVtxRunwise%d",iEstimator )   , fgRunID, fgRunID);
+      if( fillGlobal ){
+        fgAvgMultVsVtxGlobal [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileY( Form("AvgMultVsVtxGlobal%d", iEstimator)    );
+        fgAvgMultVsRun       [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileX( Form("AvgMultVsRun%d", iEstimator)  );
+      }
+      for( int iReference = 0; iReference < kNReferenceMultiplicities; ++ iReference  ){
+        Double_t refVsVtx, refVsVtxGlobal, refVsRun;
+        switch ( iReference ){
+          case kMaximumMultiplicity :
+            refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
+            if( fillGlobal ){
+              refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
+              refVsRun       = fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
+            }
+            break;
+          case kMinimumMultiplicity :
+            refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
+            if( fillGlobal ){
+              refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
+              refVsRun       = fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
+            }
+            break;
+          case kMeanMultiplicity :
+            refVsVtx = 0.5 * ( fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
+            if( fillGlobal ){
+              refVsVtxGlobal = 0.5 * ( fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum() ) ;
+              refVsRun       = 0.5 * ( fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
+            }
+            break;
+        }
+        fgRefMultVsVtxRunwise  [iEstimator][iReference] = refVsVtx;
+        if(fillGlobal){
+          fgRefMultVsVtxGlobal [iEstimator][iReference] = refVsVtxGlobal;
+          fgRefMultVsRun       [iEstimator][iReference] = refVsRun;
+        }
+      }
+    }
+  }
+  fgCurrentRunNumber = runNo;
+}
+
 //__________________________________________________________________
 void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values, EVENTPLANE* eventF/*=0x0*/) {
   //
@@ -338,102 +462,15 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   
   EVENT* event = (EVENT*)baseEvent;
   
-  // Update run wise information if available (needed for the first event filled and whenever the run changes)
-  if(fgCurrentRunNumber!=baseEvent->RunNo()) {
-    fgCurrentRunNumber = baseEvent->RunNo();
-    // GRP and LHC information
-    if(fgRunTotalLuminosity) values[kTotalLuminosity] = fgRunTotalLuminosity->GetBinContent(fgRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity0) values[kBeamIntensity0] = fgRunTotalIntensity0->GetBinContent(fgRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity1) values[kBeamIntensity1] = fgRunTotalIntensity1->GetBinContent(fgRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunLHCFillNumber) values[kLHCFillNumber] = fgRunLHCFillNumber->GetBinContent(fgRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunDipolePolarity) values[kDipolePolarity] = fgRunDipolePolarity->GetBinContent(fgRunDipolePolarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunL3Polarity) values[kL3Polarity] = fgRunL3Polarity->GetBinContent(fgRunL3Polarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeStart) values[kRunTimeStart] = fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeEnd) values[kRunTimeEnd] = fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    
-    // VZERO calibration
-    if(fgVZEROCalibrationPath.Data()[0]!='\0') {
-       cout << "AliReducedVarManager::Info  Attempting to load VZERO calibration and/or recentering histograms from path: " << endl << fgVZEROCalibrationPath.Data() << endl;
-      TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", fgVZEROCalibrationPath.Data(), fgCurrentRunNumber));
-      THashList* mainList = (THashList*)calibFile->Get("jpsi2eeHistos");
-      THashList* calibList = (THashList*)mainList->FindObject("Event_AfterCuts");
-      if(!calibList) {
-         cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << fgCurrentRunNumber << endl;
-         cout << "                        Will run uncalibrated and not-recentered!" << endl;
-         fgOptionCalibrateVZEROqVec = kFALSE;
-         fgOptionRecenterVZEROqVec = kFALSE;
-      }
-      cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << fgCurrentRunNumber << endl;
-      if(fgOptionCalibrateVZEROqVec) {
-        for(Int_t iCh=0; iCh<64; ++iCh) {
-           
-           fgAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", fgCurrentRunNumber, iCh));
-           fgAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
-        }
-      }
-      if(fgOptionRecenterVZEROqVec) {
-         fgVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[0]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[1]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[2]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[3]->SetDirectory(0x0);
-      }
-      calibFile->Close();
-    }
-
-    if(fgUsedVars[kRunID]){
-      if( fgRunID < 0 ){
-        for( fgRunID = 0; fgRunNumbers[ fgRunID ] != fgCurrentRunNumber && fgRunID< fgRunNumbers.size() ; ++fgRunID );
-      }
-    }
-    for( int iEstimator =0 ; iEstimator < kNMultiplicityEstimators ; ++iEstimator ){
-      if( fgAvgMultVsVtxAndRun[iEstimator] ){
-        Bool_t fillGlobal = !fgAvgMultVsVtxGlobal[iEstimator];
-        fgAvgMultVsVtxRunwise  [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileY( Form("AvgMultVsVtxRunwise%d",iEstimator )   , fgRunID, fgRunID);
-        if( fillGlobal ){
-          fgAvgMultVsVtxGlobal [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileY( Form("AvgMultVsVtxGlobal%d", iEstimator)    );
-          fgAvgMultVsRun       [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProfileX( Form("AvgMultVsRun%d", iEstimator)  );
-        }
-        for( int iReference = 0; iReference < kNReferenceMultiplicities; ++ iReference  ){
-          Double_t refVsVtx, refVsVtxGlobal, refVsRun;
-          switch ( iReference ){
-            case kMaximumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
-              if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
-                refVsRun       = fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
-              }
-              break;
-            case kMinimumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
-              if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
-                refVsRun       = fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
-              }
-              break;
-            case kMeanMultiplicity :
-              refVsVtx = 0.5 * ( fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
-              if( fillGlobal ){
-                refVsVtxGlobal = 0.5 * ( fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum() ) ;
-                refVsRun       = 0.5 * ( fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
-              }
-              break;
-          }
-          fgRefMultVsVtxRunwise  [iEstimator][iReference] = refVsVtx;
-          if(fillGlobal){
-            fgRefMultVsVtxGlobal [iEstimator][iReference] = refVsVtxGlobal;
-            fgRefMultVsRun       [iEstimator][iReference] = refVsRun;
-          }
-        }
-      }
-    }
+  // Update run wise information if available (needed for the first event filled and whenever the run changes).
+  // The run wise information is shared by all users of the manager, so it is only read under the lock.
+  {
+    R__LOCKGUARD2(fgRunInfoMutex);
+    if(fgCurrentRunNumber!=baseEvent->RunNo()) UpdateRunWiseInfo(baseEvent->RunNo());
+    for(Int_t i=0; i<kNRunWiseVariables; ++i) values[i] = fgRunWiseValues[i];
+    values[kRunNo] = fgCurrentRunNumber;
+    values[kRunID] = fgRunID;
   }
-
-  values[kRunNo] = fgCurrentRunNumber;
-  values[kRunID] = fgRunID;
   
   values[kEventNumberInFile]    = event->EventNumberInFile();
   values[kBC]                   = event->BC();
@@ -474,35 +511,21 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   for(Int_t iflag=0;iflag<32;++iflag) 
     values[kNTracksPerTrackingStatus+iflag] = event->TracksPerTrackingFlag(iflag);
   
-  // set the fgUsedVars to true as these might have been set to false in the previous event
-  fgUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
+  // NOTE: the ratios below are left untouched if undefined in this event; the used variables flags
+  //       are shared between all the tasks and threads and are not modified during event filling
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kITSout])>0.01) {
     values[kNTracksTPCoutVsITSout] = values[kNTracksPerTrackingStatus+kTPCout]/values[kNTracksPerTrackingStatus+kITSout];
     values[kNTracksTRDoutVsITSout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kITSout]; 
     values[kNTracksTOFoutVsITSout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kITSout];
   }
-  else {
-     // if these values are undefined, set fgUsedVars as false such that the values are not filled in histograms
-     fgUsedVars[kNTracksTPCoutVsITSout] = kFALSE; fgUsedVars[kNTracksTRDoutVsITSout] = kFALSE; fgUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
-  }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTPCout])>0.01) {
     values[kNTracksTRDoutVsTPCout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kTPCout];
     values[kNTracksTOFoutVsTPCout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTPCout];
   }
-  else {
-     fgUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; fgUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
-  }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTRDout])>0.01)
     values[kNTracksTOFoutVsTRDout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTRDout];
-  else
-     fgUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
 
   // Multiplicity estimators
 
@@ -525,116 +548,111 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     if( ieta < 7 || ieta > 24 ) values[ GetMultiplicityEstimator(kSPDntrackletsOuterEta) ] += event->SPDntracklets(ieta);
   }
 
-  for( Int_t iEstimator = 0; iEstimator < kNMultiplicityEstimators; ++iEstimator){
-    if( iEstimator == kVZEROACTotalMult || iEstimator == kSPDnTrackletsEtaVtxCorr ){
-       for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
-          for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
-            Int_t indexNotSmeared = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kNoSmearing );
-            Int_t indexSmeared    = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kPoissonSmearing );
-            values[indexNotSmeared] = 0.;
-            values[indexSmeared] = 0.;
-
-            if( iEstimator == kSPDnTrackletsEtaVtxCorr ){
-              for( Int_t ieta=6; ieta<26; ++ieta ) {
-                Int_t indexBinNotSmeared = GetMultiplicityEstimator( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kNoSmearing );
-                Int_t indexBinSmeared    = GetMultiplicityEstimator( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kPoissonSmearing );
+  {
+    // the corrections use the run wise averages, which are replaced when the run changes
+    R__LOCKGUARD2(fgRunInfoMutex);
+    if(fgCurrentRunNumber!=event->RunNo()) UpdateRunWiseInfo(event->RunNo());
+    for( Int_t iEstimator = 0; iEstimator < kNMultiplicityEstimators; ++iEstimator){
+      if( iEstimator == kVZEROACTotalMult || iEstimator == kSPDnTrackletsEtaVtxCorr ){
+         for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
+            for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
+              Int_t indexNotSmeared = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kNoSmearing );
+              Int_t indexSmeared    = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kPoissonSmearing );
+              values[indexNotSmeared] = 0.;
+              values[indexSmeared] = 0.;
+
+              if( iEstimator == kSPDnTrackletsEtaVtxCorr ){
+                for( Int_t ieta=6; ieta<26; ++ieta ) {
+                  Int_t indexBinNotSmeared = GetMultiplicityEstimator( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kNoSmearing );
+                  Int_t indexBinSmeared    = GetMultiplicityEstimator( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kPoissonSmearing );
                 
-                if( fgUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
-                if( fgUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
+                  // the corrected eta bin multiplicities are available only if their correction profile was provided
+                  Bool_t binCorrected = (fgAvgMultVsVtxAndRun[kSPDntrackletsEtaBin+ieta]!=0x0);
+                  if( fgUsedVars[indexBinNotSmeared] || binCorrected) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
+                  if( fgUsedVars[indexBinSmeared] || binCorrected) values[ indexSmeared ] += values[ indexBinSmeared ];
+                }
               }
-            }
-            else{
-              Int_t indexAnotSmeared = GetMultiplicityEstimator( kVZEROATotalMult, iCorrection, iReference, kNoSmearing );
-              Int_t indexCnotSmeared = GetMultiplicityEstimator( kVZEROCTotalMult, iCorrection, iReference, kNoSmearing );
+              else{
+                Int_t indexAnotSmeared = GetMultiplicityEstimator( kVZEROATotalMult, iCorrection, iReference, kNoSmearing );
+                Int_t indexCnotSmeared = GetMultiplicityEstimator( kVZEROCTotalMult, iCorrection, iReference, kNoSmearing );
               
-              Int_t indexAsmeared = GetMultiplicityEstimator( kVZEROATotalMult, iCorrection, iReference, kPoissonSmearing );
-              Int_t indexCsmeared = GetMultiplicityEstimator( kVZEROCTotalMult, iCorrection, iReference, kPoissonSmearing );
+                Int_t indexAsmeared = GetMultiplicityEstimator( kVZEROATotalMult, iCorrection, iReference, kPoissonSmearing );
+                Int_t indexCsmeared = GetMultiplicityEstimator( kVZEROCTotalMult, iCorrection, iReference, kPoissonSmearing );
               
-              values[ indexNotSmeared ] = values[ indexAnotSmeared ] + values[ indexCnotSmeared ];
-              values[ indexSmeared ]    = values[ indexAsmeared ] + values[ indexCsmeared ];
-            }
+                values[ indexNotSmeared ] = values[ indexAnotSmeared ] + values[ indexCnotSmeared ];
+                values[ indexSmeared ]    = values[ indexAsmeared ] + values[ indexCsmeared ];
+              }
             
             
-          }
-       }
+            }
+         }
       
       
       
-    }
+      }
     
-    else{
-      if( fgAvgMultVsVtxAndRun[iEstimator] ){
-        Int_t vtxBin = fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->FindBin( values[kVtxZ] );
-        Int_t runBin = fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->FindBin( values[kRunID] );
-        Double_t multRaw = values[ GetMultiplicityEstimator(iEstimator) ];
-        for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
-          for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
-            Int_t indexNotSmeared = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kNoSmearing );
-            Int_t indexSmeared    = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kPoissonSmearing );
-            Double_t multCorr        = multRaw;
-            Double_t multCorrSmeared = multRaw;
-    // apply vertex and gain loss correction simultaneously
-            if( iCorrection == kVertexCorrection2D  ){
-              Double_t localAvg = fgAvgMultVsVtxAndRun[iEstimator]->GetBinContent( vtxBin, runBin);
-              Double_t refMult  = fgRefMultVsVtxAndRun[iEstimator][iReference];
-              multCorr *=  localAvg ?  refMult / localAvg : 1.;
-              Double_t deltaM =  localAvg ?  multRaw * ( refMult/localAvg - 1) : 0.;
-              multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
-            }
-            else{
-    // first apply vertex correction
-              Double_t localAvgVsVtx, refMultVsVtx;
-              switch( iCorrection ){
-                case kVertexCorrectionGlobal:
-                case kVertexCorrectionGlobalGainLoss:
-                  localAvgVsVtx = fgAvgMultVsVtxGlobal[iEstimator]->GetBinContent( vtxBin );
-                  refMultVsVtx = fgRefMultVsVtxGlobal[iEstimator][iReference];
-                  break;
-                case kVertexCorrectionRunwise:
-                case kVertexCorrectionRunwiseGainLoss:
-                  localAvgVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
-                  refMultVsVtx = fgRefMultVsVtxRunwise[iEstimator][iReference];
-                  break;
+      else{
+        if( fgAvgMultVsVtxAndRun[iEstimator] ){
+          Int_t vtxBin = fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->FindBin( values[kVtxZ] );
+          Int_t runBin = fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->FindBin( values[kRunID] );
+          Double_t multRaw = values[ GetMultiplicityEstimator(iEstimator) ];
+          for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
+            for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
+              Int_t indexNotSmeared = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kNoSmearing );
+              Int_t indexSmeared    = GetMultiplicityEstimator( iEstimator, iCorrection, iReference, kPoissonSmearing );
+              Double_t multCorr        = multRaw;
+              Double_t multCorrSmeared = multRaw;
+      // apply vertex and gain loss correction simultaneously
+              if( iCorrection == kVertexCorrection2D  ){
+                Double_t localAvg = fgAvgMultVsVtxAndRun[iEstimator]->GetBinContent( vtxBin, runBin);
+                Double_t refMult  = fgRefMultVsVtxAndRun[iEstimator][iReference];
+                multCorr *=  localAvg ?  refMult / localAvg : 1.;
+                Double_t deltaM =  localAvg ?  multRaw * ( refMult/localAvg - 1) : 0.;
+                multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
               }
-              multCorr        *= localAvgVsVtx ? refMultVsVtx / localAvgVsVtx : 1.;
-              Double_t deltaM  = localAvgVsVtx ? multRaw  * ( refMultVsVtx/localAvgVsVtx - 1) : 0.;
-              multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
-    // then apply gain loss correction
-              if( iCorrection == kVertexCorrectionGlobalGainLoss || iCorrection == kVertexCorrectionRunwiseGainLoss  ){
-                Double_t localAvgVsRun = fgAvgMultVsRun[iEstimator]->GetBinContent( runBin );
-                Double_t refMultVsRun  = fgRefMultVsRun[iEstimator][iReference];
-                multCorr        *= localAvgVsRun ? refMultVsRun / localAvgVsRun : 1.;
-                deltaM           = localAvgVsRun ? multCorrSmeared  * ( refMultVsRun/localAvgVsRun - 1) : 0;
+              else{
+      // first apply vertex correction
+                Double_t localAvgVsVtx, refMultVsVtx;
+                switch( iCorrection ){
+                  case kVertexCorrectionGlobal:
+                  case kVertexCorrectionGlobalGainLoss:
+                    localAvgVsVtx = fgAvgMultVsVtxGlobal[iEstimator]->GetBinContent( vtxBin );
+                    refMultVsVtx = fgRefMultVsVtxGlobal[iEstimator][iReference];
+                    break;
+                  case kVertexCorrectionRunwise:
+                  case kVertexCorrectionRunwiseGainLoss:
+                    localAvgVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
+                    refMultVsVtx = fgRefMultVsVtxRunwise[iEstimator][iReference];
+                    break;
+                }
+                multCorr        *= localAvgVsVtx ? refMultVsVtx / localAvgVsVtx : 1.;
+                Double_t deltaM  = localAvgVsVtx ? multRaw  * ( refMultVsVtx/localAvgVsVtx - 1) : 0.;
                 multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
+      // then apply gain loss correction
+                if( iCorrection == kVertexCorrectionGlobalGainLoss || iCorrection == kVertexCorrectionRunwiseGainLoss  ){
+                  Double_t localAvgVsRun = fgAvgMultVsRun[iEstimator]->GetBinContent( runBin );
+                  Double_t refMultVsRun  = fgRefMultVsRun[iEstimator][iReference];
+                  multCorr        *= localAvgVsRun ? refMultVsRun / localAvgVsRun : 1.;
+                  deltaM           = localAvgVsRun ? multCorrSmeared  * ( refMultVsRun/localAvgVsRun - 1) : 0;
+                  multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
+                }
               }
-            }
-            values[ indexNotSmeared ] = multCorr;
-            values[ indexSmeared ]    = multCorrSmeared;
-            fgUsedVars [indexNotSmeared] = kTRUE;
-            fgUsedVars [indexSmeared] = kTRUE;
+              values[ indexNotSmeared ] = multCorr;
+              values[ indexSmeared ]    = multCorrSmeared;
             
+            }
           }
         }
       }
     }
   }
 
-  fgUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
-  fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
   if(values[GetMultiplicityEstimator(kSPDntracklets10)]>0.01) {
     values[kNTracksITSoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kITSout]/values[GetMultiplicityEstimator(kSPDntracklets10)];
     values[kNTracksTPCoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTPCout]/values[GetMultiplicityEstimator(kSPDntracklets10)];
     values[kNTracksTRDoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTRDout]/values[GetMultiplicityEstimator(kSPDntracklets10)];
     values[kNTracksTOFoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTOFout]/values[GetMultiplicityEstimator(kSPDntracklets10)];
   }
-  else {
-     fgUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
-     fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
-  }
     
   values[kNCaloClusters]   = event->GetNCaloClusters();
   values[kNTPCclusters]    = event->NTPCClusters();
@@ -646,40 +664,36 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   values[kSPDnSingleClusters] = event->SPDnSingleClusters();
 
   //VZERO detector information
-  fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
   if(values[GetMultiplicityEstimator(kVZEROTotalMult)]>1.0e-5)
      values[kNTracksTPCoutVsVZEROTotalMult] = values[kNTracksPerTrackingStatus+kTPCout] / values[GetMultiplicityEstimator(kVZEROTotalMult)];
-  else
-     fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
   
-  values[kVZEROAemptyChannels] = 0;
-  values[kVZEROCemptyChannels] = 0;
-  for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMult+ich] = kTRUE; 
-  Float_t theta=0.0;
-  for(Int_t ich=0;ich<64;++ich) {
-    if(fgUsedVars[kVZEROChannelMult+ich]) {
+  if(fgUsedVarBlocks[kVZEROChannelBlock]) {
+    values[kVZEROAemptyChannels] = 0;
+    values[kVZEROCemptyChannels] = 0;
+    Float_t theta=0.0;
+    for(Int_t ich=0;ich<64;++ich) {
       values[kVZEROChannelMult+ich] = event->MultChannelVZERO(ich);
       if(values[kVZEROChannelMult+ich]<fgkVZEROminMult) {
-        fgUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
         if(ich<32) values[kVZEROCemptyChannels] += 1;
         else values[kVZEROAemptyChannels] += 1;
       }
-    }
-    if(fgUsedVars[kVZEROChannelEta+ich]) {
-      if(ich<32) theta = TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROCz-values[kVtxZ]));
-      else theta = TMath::Pi()-TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROAz-values[kVtxZ]));
-      values[kVZEROChannelEta+ich] = -1.0*TMath::Log(TMath::Tan(theta/2.0));
+      if(fgUsedVars[kVZEROChannelEta+ich]) {
+        if(ich<32) theta = TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROCz-values[kVtxZ]));
+        else theta = TMath::Pi()-TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROAz-values[kVtxZ]));
+        values[kVZEROChannelEta+ich] = -1.0*TMath::Log(TMath::Tan(theta/2.0));
+      }
     }
   }
   
-  fgUsedVars[kNTracksTPCoutFromPileup] = kTRUE;
   if(values[GetMultiplicityEstimator(kVZEROTotalMult)]>0.0)
      values[kNTracksTPCoutFromPileup] = values[kNTracksPerTrackingStatus+kTPCout] - (-2.55+TMath::Sqrt(2.55*2.55+4.0e-5*values[GetMultiplicityEstimator(kVZEROTotalMult)]))/2.0e-5;
-  else fgUsedVars[kNTracksTPCoutFromPileup] = kFALSE;
   
   if(!eventF && (fgUsedVars[kVZEROQvecX+0*6+1] || fgUsedVars[kVZEROQvecY+0*6+1] || fgUsedVars[kVZERORP+0*6+1])) {
     Double_t qvecVZEROA[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
     Double_t qvecVZEROC[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
+    // the calibration and recentering histograms are replaced when the run changes
+    R__LOCKGUARD2(fgRunInfoMutex);
+    if(fgCurrentRunNumber!=event->RunNo()) UpdateRunWiseInfo(event->RunNo());
     if(fgOptionCalibrateVZEROqVec && fgAvgVZEROChannelMult[0]) {
       Float_t calibVZEROMult[64] = {0.};
       for(Int_t iCh=0; iCh<64; ++iCh) {
@@ -754,7 +768,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     }    // end loop over harmonics
   }
   
-  if(eventF) {
+  if(eventF && fgUsedVarBlocks[kEventPlaneBlock]) {
     for(Int_t ih=0; ih<6; ++ih) {
       // VZERO event plane variables
       values[kVZEROQvecX+2*6+ih] = 0.0;
@@ -863,15 +877,17 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     } 
   }  // end if (eventF)
     
-  for(Int_t izdc=0;izdc<10;++izdc) values[kZDCnEnergyCh+izdc] = event->EnergyZDCnTree(izdc);
-  for(Int_t izdc=0;izdc<10;++izdc) values[kZDCpEnergyCh+izdc] = event->EnergyZDCpTree(izdc);
-  for(Int_t itzero=0;itzero<26;++itzero) values[kTZEROAmplitudeCh+itzero] = event->AmplitudeTZEROch(itzero);
-  for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOF+itzero] = event->EventTZEROStartTimeTOFfirst(itzero);
-  for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOFbest+itzero] = event->EventTZEROStartTimeTOFbest(itzero);
-  values[kTZEROzVtx] = event->VertexTZERO();
-  values[kTZEROstartTime] = event->EventTZEROStartTime();
-  values[kTZEROpileup] = event->IsPileupTZERO();
-  values[kTZEROsatellite] = event->IsSatteliteCollisionTZERO();  
+  if(fgUsedVarBlocks[kZDCTZEROBlock]) {
+    for(Int_t izdc=0;izdc<10;++izdc) values[kZDCnEnergyCh+izdc] = event->EnergyZDCnTree(izdc);
+    for(Int_t izdc=0;izdc<10;++izdc) values[kZDCpEnergyCh+izdc] = event->EnergyZDCpTree(izdc);
+    for(Int_t itzero=0;itzero<26;++itzero) values[kTZEROAmplitudeCh+itzero] = event->AmplitudeTZEROch(itzero);
+    for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOF+itzero] = event->EventTZEROStartTimeTOFfirst(itzero);
+    for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOFbest+itzero] = event->EventTZEROStartTimeTOFbest(itzero);
+    values[kTZEROzVtx] = event->VertexTZERO();
+    values[kTZEROstartTime] = event->EventTZEROStartTime();
+    values[kTZEROpileup] = event->IsPileupTZERO();
+    values[kTZEROsatellite] = event->IsSatteliteCollisionTZERO();  
+  }
 
   values[kMultEstimatorOnlineV0M]    = event->MultEstimatorOnlineV0M();
   values[kMultEstimatorOnlineV0A]    = event->MultEstimatorOnlineV0A();
@@ -1014,15 +1030,17 @@ void AliReducedVarManager::FillEventOnlineTriggers(AliReducedEventInfo* event, F
 }
 
 //_________________________________________________________________
-void AliReducedVarManager::FillEventOnlineTrigger(UShort_t triggerBit, Float_t* values) {
+void AliReducedVarManager::FillEventOnlineTrigger(UShort_t triggerBit, Float_t* values, BASEEVENT* event /*=0x0*/) {
   //
   // fill the trigger bit input
+  // The event can be given explicitly, otherwise the one set via SetEvent() is used
   //
   if(triggerBit>=64) return;
-  if(!fgEvent) return;
+  BASEEVENT* ownerEvent = (event ? event : fgEvent);
+  if(!ownerEvent) return;
   ULong64_t trigger = 1;
   values[kOnlineTrigger] = triggerBit;
-  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(trigger<<triggerBit) ? 1.0 : 0.0);
+  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)ownerEvent)->TriggerMask()&(trigger<<triggerBit) ? 1.0 : 0.0);
   values[kOnlineTriggerFired2] = (values[kOnlineTriggerFired]>0.01 ? triggerBit : -1.0); 
 }
 
@@ -1105,10 +1123,12 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
 }
 
 //_________________________________________________________________
-void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
+void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values, BASEEVENT* event /*=0x0*/) {
   //
   // fill track information
+  // The event owning the track can be given explicitly, otherwise the one set via SetEvent() is used
   //
+  BASEEVENT* ownerEvent = (event ? event : fgEvent);
   
   // Fill base track information
   if(fgUsedVars[kPt])        values[kPt]        = p->Pt();
@@ -1179,7 +1199,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
      Double_t qVec[6][2] = {{0.0}};
      for(Int_t ih=0; ih<6; ++ih) {qVec[ih][0]=values[kTPCQvecXtotal+ih]; qVec[ih][1]=values[kTPCQvecYtotal+ih];}
      EVENT* eventInfo = NULL;
-     if(fgEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)fgEvent;
+     if(ownerEvent && ownerEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)ownerEvent;
      if((p->IsA() == AliReducedTrackInfo::Class()) && eventInfo) {
         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,-0.8,-0.5*fgkTPCQvecRapGap);
         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,0.5*fgkTPCQvecRapGap,0.8);
@@ -1299,17 +1319,19 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
      values[kTPCnSigCorrected+kElectron] = (values[kTPCnSig+kElectron] - centroid)/width;   
   }
 
-  values[kTRDpidProbabilitiesLQ1D]   = pinfo->TRDpidLQ1D(0);
-  values[kTRDpidProbabilitiesLQ1D+1] = pinfo->TRDpidLQ1D(1);
-  values[kTRDpidProbabilitiesLQ2D]   = pinfo->TRDpidLQ2D(0);
-  values[kTRDpidProbabilitiesLQ2D+1] = pinfo->TRDpidLQ2D(1);
-  values[kTRDntracklets]    = pinfo->TRDntracklets(0);
-  values[kTRDntrackletsPID] = pinfo->TRDntracklets(1);
+  if(fgUsedVarBlocks[kTRDBlock]) {
+    values[kTRDpidProbabilitiesLQ1D]   = pinfo->TRDpidLQ1D(0);
+    values[kTRDpidProbabilitiesLQ1D+1] = pinfo->TRDpidLQ1D(1);
+    values[kTRDpidProbabilitiesLQ2D]   = pinfo->TRDpidLQ2D(0);
+    values[kTRDpidProbabilitiesLQ2D+1] = pinfo->TRDpidLQ2D(1);
+    values[kTRDntracklets]    = pinfo->TRDntracklets(0);
+    values[kTRDntrackletsPID] = pinfo->TRDntracklets(1);
+  }
   
-  if(fgUsedVars[kEMCALmatchedEnergy] || fgUsedVars[kEMCALmatchedEOverP]) {
+  if(fgUsedVarBlocks[kCaloBlock] && (fgUsedVars[kEMCALmatchedEnergy] || fgUsedVars[kEMCALmatchedEOverP])) {
     values[kEMCALmatchedClusterId] = pinfo->CaloClusterId();
-    if(fgEvent && (fgEvent->IsA()==EVENT::Class())){
-      CLUSTER* cluster = ((EVENT*)fgEvent)->GetCaloCluster(pinfo->CaloClusterId());
+    if(ownerEvent && (ownerEvent->IsA()==EVENT::Class())){
+      CLUSTER* cluster = ((EVENT*)ownerEvent)->GetCaloCluster(pinfo->CaloClusterId());
       values[kEMCALmatchedEnergy] = (cluster ? cluster->Energy() : -999.0);
       Float_t mom = pinfo->P();
       values[kEMCALmatchedEOverP] = (TMath::Abs(mom)>1.e-8 && cluster ? values[kEMCALmatchedEnergy]/mom : -999.0);
@@ -1414,11 +1436,13 @@ void AliReducedVarManager::GetLegMassAssumption(Int_t id, Float_t& m1, Float_t&
 }
 
 //_________________________________________________________________
-void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
+void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values, BASEEVENT* event /*=0x0*/) {
   //
   // fill pair information
+  // The event owning the pair legs can be given explicitly, otherwise the one set via SetEvent() is used
   //
-  FillTrackInfo(p, values);
+  BASEEVENT* ownerEvent = (event ? event : fgEvent);
+  FillTrackInfo(p, values, ownerEvent);
   
   values[kCandidateId]   = p->CandidateId();
   values[kPairType]      = p->PairType();
@@ -1446,9 +1470,9 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   Bool_t usePolarization=kFALSE;
   if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
-  if(usePolarization)
-    GetThetaPhiCM(fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
-		  fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
+  if(usePolarization && ownerEvent)
+    GetThetaPhiCM(ownerEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
+		  ownerEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
 		  values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS], m1, m2);
 }
 
@@ -1725,49 +1749,74 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
-  PAIR p;
-  p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
-  p.CandidateId(type);
-    
-  if(t1->Charge()*t2->Charge()<0) p.PairType(1);
-  else if(t1->Charge()>0)         p.PairType(0);
-  else                            p.PairType(2);
-  values[kPairType] = p.PairType();
-  values[kCandidateId] = type;
-  values[kPairChisquare] = -999.;
+  Int_t pairType = 2;
+  if(t1->Charge()*t2->Charge()<0) pairType = 1;
+  else if(t1->Charge()>0)         pairType = 0;
   
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
-    
-  if(fgUsedVars[kMass]) {     
-    values[kMass] = m1*m1+m2*m2 + 
-                    2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
-                    t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
-    if(values[kMass]<0.0) {
+  
+  Float_t px = t1->Px()+t2->Px();
+  Float_t py = t1->Py()+t2->Py();
+  Float_t pz = t1->Pz()+t2->Pz();
+  Float_t e1 = TMath::Sqrt(m1*m1+t1->P()*t1->P());
+  Float_t e2 = TMath::Sqrt(m2*m2+t2->P()*t2->P());
+  Float_t mass = m1*m1+m2*m2 + 2.0*(e1*e2 - t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
+  if(mass<0.0) {
+    if(fgUsedVars[kMass]) {
       cout << "FillPairInfoME(track, track, type, values): Warning: Very small squared mass found. "
            << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
-      cout << "   mass2: " << values[kMass] << endl;
+      cout << "   mass2: " << mass << endl;
       cout << "p1(p,x,y,z): " << t1->P() << ", " << t1->Px() << ", " << t1->Py() << ", " << t1->Pz() << endl;
       cout << "p2(p,x,y,z): " << t2->P() << ", " << t2->Px() << ", " << t2->Py() << ", " << t2->Pz() << endl;
-      values[kMass] = 0.0;
     }
-    else
-      values[kMass] = TMath::Sqrt(values[kMass]);
-    p.SetMass(values[kMass]);
+    mass = 0.0;
   }
+  else
+    mass = TMath::Sqrt(mass);
+  
+  Float_t e = e1+e2;
+  Float_t rapidity = (e-TMath::Abs(pz)>1.0e-10 ? 0.5*TMath::Log((e+pz)/(e-pz)) : -999.);
   
-  values[kPx] = p.Px();
-  values[kPy] = p.Py();
-  values[kPz] = p.Pz();
+  FillPairInfoME(px, py, pz, TMath::Sqrt(px*px+py*py), mass, rapidity, pairType, type, values);
+}
+
+
+//_________________________________________________________________
+void AliReducedVarManager::FillPairInfoME(Float_t px, Float_t py, Float_t pz, Float_t pt, Float_t mass, Float_t rapidity,
+                                          Int_t pairType, Int_t type, Float_t* values) {
+  //
+  // Fill the mixed event pair information from already computed pair kinematics.
+  // NOTE: Used by the AliMixingHandler, which computes the pair kinematics for all the pool combinations in batches
+  //       The pair mass and rapidity are computed with the leg mass assumptions corresponding to the candidate type
+  //
+  values[kPairType] = pairType;
+  values[kCandidateId] = type;
+  values[kPairChisquare] = -999.;
+  if(fgUsedVars[kMass]) values[kMass] = mass;
+  
+  values[kPx] = px;
+  values[kPy] = py;
+  values[kPz] = pz;
   if(fgUsedVars[kPt] || fgUsedVars[kPtSquared]) {
-    values[kPt] = p.Pt();
-    if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+    values[kPt] = pt;
+    if(fgUsedVars[kPtSquared]) values[kPtSquared] = pt*pt;
+  }
+  if(fgUsedVars[kP] || fgUsedVars[kEta] || fgUsedVars[kTheta]) {
+    Float_t p = TMath::Sqrt(pt*pt+pz*pz);
+    Float_t theta = (p>=1.0e-6 ? TMath::ACos(pz/p) : 0.0);
+    if(fgUsedVars[kP]) values[kP] = p;
+    if(fgUsedVars[kTheta]) values[kTheta] = theta;
+    if(fgUsedVars[kEta]) {
+      Float_t tanHalfTheta = TMath::Tan(0.5*theta);
+      values[kEta] = (tanHalfTheta>1.0e-6 ? -1.0*TMath::Log(tanHalfTheta) : 0.0);
+    }
+  }
+  if(fgUsedVars[kRap]) values[kRap] = rapidity;
+  if(fgUsedVars[kPhi]) {
+    Float_t phi = TMath::ATan2(py,px);
+    values[kPhi] = (phi>=0.0 ? phi : TMath::TwoPi()+phi);
   }
-  if(fgUsedVars[kP]) values[kP] = p.P();
-  if(fgUsedVars[kEta]) values[kEta] = p.Eta();
-  if(fgUsedVars[kRap]) values[kRap] = p.Rapidity();
-  if(fgUsedVars[kPhi]) values[kPhi] = p.Phi();
-  if(fgUsedVars[kTheta]) values[kTheta] = p.Theta();
 
   if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff]) && fgPairEffMap) {
     Int_t binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
@@ -2582,6 +2631,9 @@ void AliReducedVarManager::SetTPCelectronCorrectionMaps(TH2F* centroidMap, TH2F*
    }
    fgVarDependencyX = varX;
    fgVarDependencyY = varY;
+   AddVariableDependency(kTPCnSigCorrected+kElectron, varX);
+   AddVariableDependency(kTPCnSigCorrected+kElectron, varY);
+   if(fgUsedVars[kTPCnSigCorrected+kElectron]) UseVariable(kTPCnSigCorrected+kElectron);
    if(centroidMap) {
      fgTPCelectronCentroidMap = (TH2F*)centroidMap->Clone(Form("AliReducedVarManager_TPCelectronCentroidMap"));
      fgTPCelectronCentroidMap->SetDirectory(0x0);
@@ -2609,6 +2661,10 @@ void AliReducedVarManager::SetPairEfficiencyMap(TH2F* effMap, AliReducedVarManag
   }
   fgEffMapVarDependencyX = varX; 
   fgEffMapVarDependencyY = varY;
+  AddVariableDependency(kPairEff, varX);        AddVariableDependency(kPairEff, varY);
+  AddVariableDependency(kOneOverPairEff, varX); AddVariableDependency(kOneOverPairEff, varY);
+  if(fgUsedVars[kPairEff]) UseVariable(kPairEff);
+  if(fgUsedVars[kOneOverPairEff]) UseVariable(kOneOverPairEff);
   if(effMap) {
     fgPairEffMap = (TH2F*)effMap->Clone(Form("AliReducedVarManager_PairEffMap"));
     fgPairEffMap->SetDirectory(0x0);
@@ -14,6 +14,8 @@
 #include <TH2F.h>
 #include <TProfile2D.h>
 
+#include <vector>
+
 class AliReducedBaseEvent;
 class AliReducedEventInfo;
 class AliReducedEventPlaneInfo;
@@ -21,6 +23,7 @@ class AliReducedBaseTrack;
 class AliReducedTrackInfo;
 class AliReducedPairInfo;
 class AliReducedCaloClusterInfo;
+class TVirtualMutex;
 
 //_____________________________________________________________________
 class AliReducedVarManager : public TObject {
@@ -545,6 +548,16 @@ class AliReducedVarManager : public TObject {
     kNVars=kTrackingStatus+kNTrackingStatus,     
   };
   
+  // groups of variables filled together from a detector; a block is skipped when none of its variables is used
+  enum VariableBlocks {
+    kVZEROChannelBlock=0,   // VZERO channel multiplicities and pseudo-rapidities
+    kEventPlaneBlock,       // VZERO and TPC Q-vectors, event planes and their correlations
+    kZDCTZEROBlock,         // ZDC and TZERO channel information
+    kTRDBlock,              // TRD tracklets and PID probabilities
+    kCaloBlock,             // calorimeter cluster matching
+    kNVarBlocks
+  };
+  
   static TString fgVariableNames[kNVars];         // variable names
   static TString fgVariableUnits[kNVars];         // variable units  
   static const Char_t* fgkTrackingStatusNames[kNTrackingStatus];  // tracking flags name
@@ -566,19 +579,19 @@ class AliReducedVarManager : public TObject {
   
   static void SetEvent(AliReducedBaseEvent* const ev) {fgEvent = ev;};
   static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgEventPlane = ev;};
-  static void SetUseVariable(Variables var) {fgUsedVars[var] = kTRUE; SetVariableDependencies();}
+  static void SetUseVariable(Variables var) {UseVariable(var);}
   static void SetUseVars(Bool_t* usedVars) {
     for(Int_t i=0;i<kNVars;++i) {
-      if(usedVars[i]) fgUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
+      if(usedVars[i]) UseVariable(i);    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
     }
-    SetVariableDependencies();
   }
   static Bool_t GetUsedVar(Variables var) {return fgUsedVars[var];}
+  static Bool_t GetUsedVarBlock(VariableBlocks block) {return fgUsedVarBlocks[block];}
   
   static void FillEventInfo(Float_t* values);
   static void FillEventInfo(AliReducedBaseEvent* event, Float_t* values, AliReducedEventPlaneInfo* eventPlane=0x0);
   static void FillEventOnlineTriggers(AliReducedEventInfo* event, Float_t* values);
-  static void FillEventOnlineTrigger(UShort_t triggerBit, Float_t* values);
+  static void FillEventOnlineTrigger(UShort_t triggerBit, Float_t* values, AliReducedBaseEvent* event=0x0);
   static void FillEventTagInput(AliReducedBaseEvent* event, Int_t input, Float_t* values);
   static void FillL0TriggerInputs(AliReducedEventInfo* event, Int_t input, Float_t* values);
   static void FillL1TriggerInputs(AliReducedEventInfo* event, Int_t input, Float_t* values);
@@ -586,19 +599,22 @@ class AliReducedVarManager : public TObject {
   static void FillTrackingFlag(AliReducedTrackInfo* track, UInt_t flag, Float_t* values);
   static void FillTrackQualityFlag(AliReducedBaseTrack* track, UShort_t flag, Float_t* values);
   static void FillPairQualityFlag(AliReducedPairInfo* p, UShort_t flag, Float_t* values);
-  static void FillTrackInfo(AliReducedBaseTrack* p, Float_t* values);
+  static void FillTrackInfo(AliReducedBaseTrack* p, Float_t* values, AliReducedBaseEvent* event=0x0);
   static void FillITSlayerFlag(AliReducedTrackInfo* track, Int_t layer, Float_t* values);
   static void FillTPCclusterBitFlag(AliReducedTrackInfo* track, Int_t bit, Float_t* values);
-  static void FillPairInfo(AliReducedPairInfo* p, Float_t* values);
+  static void FillPairInfo(AliReducedPairInfo* p, Float_t* values, AliReducedBaseEvent* event=0x0);
   static void FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
   static void FillPairInfo(AliReducedPairInfo* leg1, AliReducedBaseTrack* leg2, Int_t type, Float_t* values);
   static void FillPairInfoME(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
+  static void FillPairInfoME(Float_t px, Float_t py, Float_t pz, Float_t pt, Float_t mass, Float_t rapidity,
+                             Int_t pairType, Int_t type, Float_t* values);
   static void FillCorrelationInfo(AliReducedPairInfo* p, AliReducedBaseTrack* t, Float_t* values);
   static void FillCaloClusterInfo(AliReducedCaloClusterInfo* cl, Float_t* values);
   static void FillTrackingStatus(AliReducedTrackInfo* p, Float_t* values);
  // static void FillTrackingFlags(AliReducedTrackInfo* p, Float_t* values);
   static void FillMCTruthInfo(AliReducedTrackInfo* p, Float_t* values, AliReducedTrackInfo* leg1 = 0x0, AliReducedTrackInfo* leg2 = 0x0);
   
+  static void GetLegMassAssumption(Int_t id, Float_t& m1, Float_t& m2);
   static void PrintTrackFlags(AliReducedTrackInfo* track);
   static void PrintBits(ULong_t mask, Int_t maxBit=64);
   static void PrintBits(UInt_t mask, Int_t maxBit=32);
@@ -629,7 +645,16 @@ class AliReducedVarManager : public TObject {
   static AliReducedEventPlaneInfo* fgEventPlane;  // pointer to the current event plane
   static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
                                                  //   when a variable is used
-  static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
+  static Bool_t fgUsedVarBlocks[kNVarBlocks];    // flags toggled when at least one variable of the corresponding block is used
+  static std::vector<Int_t> fgVarDependencies[kNVars];  // variable dependency graph: variables needed to compute a given variable
+  static Bool_t fgVarDependenciesCompiled;       // flag set once the dependency graph was built
+  static void CompileVariableDependencies();     // build the variable dependency graph (done only once)
+  static void AddVariableDependency(Int_t var, Int_t dependency);
+  static void UseVariable(Int_t var);            // toggle a variable and all the variables on which it depends
+  static Int_t GetVariableBlock(Int_t var);
+  static Float_t fgRunWiseValues[kNRunWiseVariables];  // run wise values for the current run, copied in every values buffer
+  static TVirtualMutex* fgRunInfoMutex;          // protects the loading of the run wise information and all reads of it
+  static void UpdateRunWiseInfo(Int_t runNo);
   
 
   static Double_t DeltaPhi(Double_t phi1, Double_t phi2);  
@@ -637,7 +662,6 @@ class AliReducedVarManager : public TObject {
                             Float_t &thetaHE, Float_t &phiHE, 
 			    Float_t &thetaCS, Float_t &phiCS,
 			    Float_t leg1Mass=fgkParticleMass[kElectron], Float_t leg2Mass=fgkParticleMass[kElectron]);
-  static void GetLegMassAssumption(Int_t id, Float_t& m1, Float_t& m2);
 
   static TH2F* fgTPCelectronCentroidMap;    // TPC electron centroid 2D map
   static TH2F* fgTPCelectronWidthMap;       // TPC electron width 2D map
@@ -356,6 +356,8 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
   fDoInvMassShowerShapeTree(kFALSE),
+  fDoSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection(),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -658,6 +660,8 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
   fDoInvMassShowerShapeTree(kFALSE),
+  fDoSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection(),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -2313,6 +2317,11 @@ void AliAnalysisTaskGammaConvCalo::UserCreateOutputObjects(){
     fOutputContainer->Add(tBrokenFiles);
   }
 
+  if(fDoSharedPhotonSelection){
+    std::vector<AliConversionPhotonCuts*> photonCuts;
+    for(Int_t iCut = 0; iCut<fnCuts; iCut++) photonCuts.push_back((AliConversionPhotonCuts*)fCutArray->At(iCut));
+    fSharedPhotonSelection.Init(photonCuts);
+  }
 
   PostData(1, fOutputContainer);
 }
@@ -2385,6 +2394,7 @@ void AliAnalysisTaskGammaConvCalo::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  fSharedPhotonSelection.NewEvent(fReaderGammas->GetEntriesFast());
 
   // ------------------- BeginEvent ----------------------------
   AliEventplane *EventPlane = fInputEvent->GetEventplane();
@@ -2991,7 +3001,7 @@ void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromMBHeader = kFALSE;
     }
 
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(!fSharedPhotonSelection.PhotonIsSelected((AliConversionPhotonCuts*)fCutArray->At(fiCut),fiCut,PhotonCandidate,fInputEvent,i)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
     !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -11,6 +11,7 @@
 #include "AliConvEventCuts.h"
 #include "AliConversionPhotonCuts.h"
 #include "AliConversionMesonCuts.h"
+#include "AliConvSharedCutSelection.h"
 #include "AliAnalysisManager.h"
 #include "TProfile2D.h"
 #include "TH3.h"
@@ -136,6 +137,9 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
   
         // Function to enable MC label sorting
     void SetEnableSortingOfMCClusLabels (Bool_t enableSort) { fEnableSortForClusMC   = enableSort;}
+    
+    // Functions to share the photon and cluster selection between cut sets with identical photon or cluster cuts
+    void SetDoSharedPhotonSelection     (Bool_t flag)       { fDoSharedPhotonSelection = flag;}
 
     
   protected:
@@ -471,6 +475,8 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     Bool_t                  fEnableSortForClusMC;                               // switch on sorting for MC labels in cluster
     Bool_t                  fDoPrimaryTrackMatching;                            // switch for basic track matching for primaries
     Bool_t                  fDoInvMassShowerShapeTree;                          // flag for producing tree tESDInvMassShowerShape
+    Bool_t                  fDoSharedPhotonSelection;                           // evaluate each photon selection stage only once per event for cut sets with identical settings in this stage (light output only)
+    AliConvSharedCutSelection fSharedPhotonSelection;                           //! photon selection stage results of the current event, shared between cut sets
     TTree*                  tBrokenFiles;                                       // tree for keeping track of broken files
     TObjString*             fFileNameBroken;                                    // string object for broken file name
     
@@ -479,7 +485,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 41);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 44);
 };
 
 #endif
@@ -263,6 +263,16 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fDoSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection(),
+  fDoSharedBGPools(kFALSE),
+  fBGPoolOwner(),
+  fBGPoolIsShared(),
+  fBGPoolPending(),
+  fBGPoolPendingMult(),
+  fBGPhotonBuffers(),
+  fBGPhotonBufferPool(-1),
+  fBGPoolInputList(NULL),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -473,6 +483,16 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fDoSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection(),
+  fDoSharedBGPools(kFALSE),
+  fBGPoolOwner(),
+  fBGPoolIsShared(),
+  fBGPoolPending(),
+  fBGPoolPendingMult(),
+  fBGPhotonBuffers(),
+  fBGPhotonBufferPool(-1),
+  fBGPoolInputList(NULL),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -499,6 +519,11 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     delete[] fWeightCentrality; 
     fWeightCentrality = 0x0; 
   }
+  
+  if(fBGPoolInputList){
+    delete fBGPoolInputList;
+    fBGPoolInputList = 0x0;
+  }
     
 }
 //___________________________________________________________
@@ -585,6 +610,39 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
       }
     }
   }
+  
+  // Cut sets with identical event and photon cuts and the same pool settings fill identical background pools.
+  // If requested, they mix with the pool of the first of them, which is then filled only once per event.
+  fBGPoolOwner.assign(fnCuts,-1);
+  fBGPoolIsShared.assign(fnCuts,kFALSE);
+  fBGPoolPending.assign(fnCuts,std::vector<AliAODConversionPhoton>());
+  fBGPoolPendingMult.assign(fnCuts,-1);
+  for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+    if(!fBGHandler[iCut]) continue;
+    fBGPoolOwner[iCut] = iCut;
+    if(!fDoSharedBGPools) continue;
+    AliConversionMesonCuts* mesonCuts = (AliConversionMesonCuts*)fMesonCutArray->At(iCut);
+    if(mesonCuts->UseMCPSmearing()) continue; // candidates are smeared differently for each cut set
+    for(Int_t jCut = 0; jCut<iCut; jCut++){
+      if(fBGPoolOwner[jCut] != jCut) continue;
+      AliConversionMesonCuts* ownerMesonCuts = (AliConversionMesonCuts*)fMesonCutArray->At(jCut);
+      if(ownerMesonCuts->UseMCPSmearing()) continue;
+      if(((AliConvEventCuts*)fEventCutArray->At(iCut))->GetCutNumber().CompareTo(((AliConvEventCuts*)fEventCutArray->At(jCut))->GetCutNumber()) != 0) continue;
+      if(((AliConversionPhotonCuts*)fCutArray->At(iCut))->GetCutNumber().CompareTo(((AliConversionPhotonCuts*)fCutArray->At(jCut))->GetCutNumber()) != 0) continue;
+      if(mesonCuts->GetNumberOfBGEvents() != ownerMesonCuts->GetNumberOfBGEvents()) continue;
+      if(mesonCuts->UseTrackMultiplicity() != ownerMesonCuts->UseTrackMultiplicity()) continue;
+      // the rotation method reads the background probability of the pool
+      if(mesonCuts->UseRotationMethod() != ownerMesonCuts->UseRotationMethod()) continue;
+      if(mesonCuts->DoBGProbability() != ownerMesonCuts->DoBGProbability()) continue;
+      delete fBGHandler[iCut];
+      fBGHandler[iCut] = fBGHandler[jCut];
+      fBGPoolOwner[iCut] = jCut;
+      fBGPoolIsShared[jCut] = kTRUE;
+      AliInfo(Form("background pool of cut set %d is shared with cut set %d", iCut, jCut));
+      break;
+    }
+  }
+  if(!fBGPoolInputList) fBGPoolInputList = new TList();
 }
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
@@ -1593,6 +1651,12 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
     fOutputContainer->Add(tBrokenFiles);
   }
   
+  if(fDoSharedPhotonSelection){
+    std::vector<AliConversionPhotonCuts*> photonCuts;
+    for(Int_t iCut = 0; iCut<fnCuts; iCut++) photonCuts.push_back((AliConversionPhotonCuts*)fCutArray->At(iCut));
+    fSharedPhotonSelection.Init(photonCuts);
+  }
+  
   PostData(1, fOutputContainer);
 }
 //_____________________________________________________________________________
@@ -1667,6 +1731,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  fSharedPhotonSelection.NewEvent(fReaderGammas->GetEntriesFast());
   
   // ------------------- BeginEvent ----------------------------
 
@@ -1678,6 +1743,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
     RelabelAODPhotonCandidates(kTRUE);    // In case of AODMC relabeling MC
     fV0Reader->RelabelAODs(kTRUE);
   }
+  fBGPhotonBufferPool = -1;
   for(Int_t iCut = 0; iCut<fnCuts; iCut++){
     fiCut = iCut;
     
@@ -1861,6 +1927,13 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
 
     fGammaCandidates->Clear(); // delete this cuts good gammas
   }
+  
+  // add the current event to the shared background pools, now that all their cut sets have been mixed
+  for(UInt_t pool = 0; pool<fBGPoolPendingMult.size(); pool++){
+    if(fBGPoolPendingMult[pool] < 0) continue;
+    AddEventToBGPool(pool,fBGPoolPending[pool],fBGPoolPendingMult[pool]);
+    fBGPoolPendingMult[pool] = -1;
+  }
 
   if( fIsMC > 0 && fInputEvent->IsA()==AliAODEvent::Class() && !(fV0Reader->AreAODsRelabeled())){
     RelabelAODPhotonCandidates(kFALSE); // Back to ESDMC Label
@@ -1891,7 +1964,7 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromSelectedHeader = kFALSE;
     }
   
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(!fSharedPhotonSelection.PhotonIsSelected((AliConversionPhotonCuts*)fCutArray->At(fiCut),fiCut,PhotonCandidate,fInputEvent,i)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
       !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -3478,81 +3551,60 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
       }
     }
   } else {
-    AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
-
-    if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-      for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-        }
+    // the moved and rotated photons of the pool are shared by all cut sets mixing with it in this event
+    if(fBGPhotonBufferPool != fBGPoolOwner[fiCut]){
+      FillBGPhotonBuffers(zbin,mbin);
+      fBGPhotonBufferPool = fBGPoolOwner[fiCut];
+    }
 
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-          if(fMoveParticleAccordingToVertex == kTRUE){
-            MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-          }
-          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-            RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-          }
-          
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+    for(UInt_t nEventsInBG=0;nEventsInBG<fBGPhotonBuffers.size();nEventsInBG++){
+      std::vector<AliAODConversionPhoton> &previousEventV0s = fBGPhotonBuffers[nEventsInBG];
+      for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
+        AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+        for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+          AliAODConversionMother backgroundCandidate(currentEventGoodV0,&previousEventV0s[iPrevious]);
+          backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
           if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+            ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(),fWeightJetJetMC);
             if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+              Double_t sparesFill[4] = {backgroundCandidate.M(),backgroundCandidate.Pt(),(Double_t)zbin,(Double_t)mbin};
               if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
               else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
             }
           }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
-        }
         }
       }
-    } else {
-      for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-        }
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-
-            if(fMoveParticleAccordingToVertex == kTRUE){
-              MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-            }
-            if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-              RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-            }
-
-
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-              ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-              else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-                else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-              }
-            }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
-          }
-        }
-        }
+    }
+  }
+}
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::FillBGPhotonBuffers(Int_t zbin, Int_t mbin){
+  // Copy the photons of each background event of the pool of the current cut set into a contiguous buffer,
+  // moved to the current vertex and rotated to the current event plane. A shared pool stores the photons
+  // relative to the vertex of their event, so moving them is a single offset for all background events.
+  Bool_t doInPlaneOutOfPlane = (((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0);
+  Bool_t isSharedPool = fBGPoolIsShared[fBGPoolOwner[fiCut]];
+  const AliVVertex *primVtx = fInputEvent->GetPrimaryVertex();
+
+  fBGPhotonBuffers.resize(fBGHandler[fiCut]->GetNBGEvents());
+  for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+    std::vector<AliAODConversionPhoton> &buffer = fBGPhotonBuffers[nEventsInBG];
+    buffer.clear();
+    AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+    if(!previousEventV0s) continue;
+    AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
+
+    buffer.reserve(previousEventV0s->size());
+    for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+      buffer.push_back(*(previousEventV0s->at(iPrevious)));
+      if(fMoveParticleAccordingToVertex == kTRUE){
+        if(isSharedPool) ShiftConversionPoint(&buffer.back(),primVtx->GetX(),primVtx->GetY(),primVtx->GetZ());
+        else ShiftConversionPoint(&buffer.back(),-(bgEventVertex->fX - primVtx->GetX()),-(bgEventVertex->fY - primVtx->GetY()),-(bgEventVertex->fZ - primVtx->GetZ()));
+      }
+      if(doInPlaneOutOfPlane){
+        RotateParticleAccordingToEP(&buffer.back(),bgEventVertex->fEP,fEventPlaneAngle);
       }
     }
   }
@@ -3667,14 +3719,10 @@ void AliAnalysisTaskGammaConvV1::RotateParticleAccordingToEP(AliAODConversionPho
 }
 
 //________________________________________________________________________
-void AliAnalysisTaskGammaConvV1::MoveParticleAccordingToVertex(AliAODConversionPhoton* particle,const AliGammaConversionAODBGHandler::GammaConversionVertex *vertex){
+void AliAnalysisTaskGammaConvV1::ShiftConversionPoint(AliAODConversionPhoton* particle, Double_t dx, Double_t dy, Double_t dz){
   //see header file for documentation
 
-  Double_t dx = vertex->fX - fInputEvent->GetPrimaryVertex()->GetX();
-  Double_t dy = vertex->fY - fInputEvent->GetPrimaryVertex()->GetY();
-  Double_t dz = vertex->fZ - fInputEvent->GetPrimaryVertex()->GetZ();
-
-  Double_t movedPlace[3] = {particle->GetConversionX() - dx,particle->GetConversionY() - dy,particle->GetConversionZ() - dz};
+  Double_t movedPlace[3] = {particle->GetConversionX() + dx,particle->GetConversionY() + dy,particle->GetConversionZ() + dz};
   particle->SetConversionPoint(movedPlace);
 }
 
@@ -3682,15 +3730,48 @@ void AliAnalysisTaskGammaConvV1::MoveParticleAccordingToVertex(AliAODConversionP
 void AliAnalysisTaskGammaConvV1::UpdateEventByEventData(){
   //see header file for documentation
   if(fGammaCandidates->GetEntries() >0 ){
-    if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-      fBGHandler[fiCut]->AddEvent(fGammaCandidates,fInputEvent->GetPrimaryVertex()->GetX(),fInputEvent->GetPrimaryVertex()->GetY(),fInputEvent->GetPrimaryVertex()->GetZ(),fV0Reader->GetNumberOfPrimaryTracks(),fEventPlaneAngle);
+    Int_t multiplicity = fGammaCandidates->GetEntries(); // means we use #V0s for multiplicity
+    if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()) multiplicity = fV0Reader->GetNumberOfPrimaryTracks();
+
+    Int_t pool = fBGPoolOwner[fiCut];
+    if(fBGPoolIsShared[pool]){
+      // the event is added after all cut sets using the pool have been mixed with it,
+      // their candidates are identical so the first cut set provides them
+      if(fBGPoolPendingMult[pool] < 0){
+        CopyEventForBGPool(fBGPoolPending[pool]);
+        fBGPoolPendingMult[pool] = multiplicity;
+      }
+      return;
     }
-    else{ // means we use #V0s for multiplicity
-      fBGHandler[fiCut]->AddEvent(fGammaCandidates,fInputEvent->GetPrimaryVertex()->GetX(),fInputEvent->GetPrimaryVertex()->GetY(),fInputEvent->GetPrimaryVertex()->GetZ(),fGammaCandidates->GetEntries(),fEventPlaneAngle);
+    fBGHandler[pool]->AddEvent(fGammaCandidates,fInputEvent->GetPrimaryVertex()->GetX(),fInputEvent->GetPrimaryVertex()->GetY(),fInputEvent->GetPrimaryVertex()->GetZ(),multiplicity,fEventPlaneAngle);
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::CopyEventForBGPool(std::vector<AliAODConversionPhoton> &photons){
+  // Copy the photon candidates of the current event for a shared background pool. If the pooled photons are
+  // moved to the vertex of the event they are mixed with, they are stored relative to the vertex of this event.
+  const AliVVertex *primVtx = fInputEvent->GetPrimaryVertex();
+  photons.clear();
+  photons.reserve(fGammaCandidates->GetEntries());
+  for(Int_t i=0;i<fGammaCandidates->GetEntries();i++){
+    photons.push_back(*(AliAODConversionPhoton*)(fGammaCandidates->At(i)));
+    if(fMoveParticleAccordingToVertex == kTRUE){
+      ShiftConversionPoint(&photons.back(),-primVtx->GetX(),-primVtx->GetY(),-primVtx->GetZ());
     }
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::AddEventToBGPool(Int_t pool, std::vector<AliAODConversionPhoton> &photons, Int_t multiplicity){
+  // Add the photons of the current event to the background pool owned by cut set pool
+  const AliVVertex *primVtx = fInputEvent->GetPrimaryVertex();
+  fBGPoolInputList->Clear();
+  for(UInt_t i=0;i<photons.size();i++) fBGPoolInputList->Add(&photons[i]);
+  fBGHandler[pool]->AddEvent(fBGPoolInputList,primVtx->GetX(),primVtx->GetY(),primVtx->GetZ(),multiplicity,fEventPlaneAngle);
+  fBGPoolInputList->Clear();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::FillPhotonCombinatorialBackgroundHist(AliAODConversionPhoton *TruePhotonCandidate, Int_t pdgCode[], Double_t PhiParticle[])
 {
@@ -10,6 +10,7 @@
 #include "AliGammaConversionAODBGHandler.h"
 #include "AliConversionAODBGHandlerRP.h"
 #include "AliConversionMesonCuts.h"
+#include "AliConvSharedCutSelection.h"
 #include "AliAnalysisManager.h"
 #include "TProfile2D.h"
 #include "TH3.h"
@@ -68,14 +69,19 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
                                                                   fClusterCutArray              = CutArray  ;}
                                                                   
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag) {fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
+    void SetDoSharedPhotonSelection(Bool_t flag)                  { fDoSharedPhotonSelection    = flag    ;}
+    void SetDoSharedBGPools(Bool_t flag)                          { fDoSharedBGPools            = flag    ;}
     
     // BG HandlerSettings
     void SetMoveParticleAccordingToVertex(Bool_t flag)            {fMoveParticleAccordingToVertex = flag;}
     void FillPhotonCombinatorialBackgroundHist(AliAODConversionPhoton *TruePhotonCandidate, Int_t pdgCode[], Double_t PhiParticle[]);
     void FillPhotonCombinatorialMothersHistESD(TParticle *daughter,TParticle *mother);
     void FillPhotonCombinatorialMothersHistAOD(AliAODMCParticle *daughter, AliAODMCParticle* motherCombPart);
-    void MoveParticleAccordingToVertex(AliAODConversionPhoton* particle,const AliGammaConversionAODBGHandler::GammaConversionVertex *vertex);
+    void ShiftConversionPoint(AliAODConversionPhoton* particle, Double_t dx, Double_t dy, Double_t dz);
     void UpdateEventByEventData();
+    void CopyEventForBGPool(std::vector<AliAODConversionPhoton> &photons);
+    void AddEventToBGPool(Int_t pool, std::vector<AliAODConversionPhoton> &photons, Int_t multiplicity);
+    void FillBGPhotonBuffers(Int_t zbin, Int_t mbin);
     void SetLogBinningXTH2(TH2* histoRebin);
     Int_t GetSourceClassification(Int_t daughter, Int_t pdgCode);
 
@@ -300,6 +306,16 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Double_t*                         fWeightCentrality;                          //[fnCuts], weight for centrality flattening
     Bool_t                            fEnableClusterCutsForTrigger;               //enables ClusterCuts for Trigger
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
+    Bool_t                            fDoSharedPhotonSelection;                   // evaluate each photon selection stage only once per event for cut sets with identical settings in this stage (light output only)
+    AliConvSharedCutSelection         fSharedPhotonSelection;                     //! photon selection stage results of the current event, shared between cut sets
+    Bool_t                            fDoSharedBGPools;                           // mix with and fill one background pool for cut sets with identical event and photon cuts and pool settings
+    std::vector<Int_t>                fBGPoolOwner;                               //! cut set owning the background pool used by each cut set
+    std::vector<Bool_t>               fBGPoolIsShared;                            //! whether the pool owned by a cut set is used by other cut sets as well
+    std::vector< std::vector<AliAODConversionPhoton> > fBGPoolPending;            //! photons of the current event to be added to a shared pool once all its cut sets have been mixed
+    std::vector<Int_t>                fBGPoolPendingMult;                         //! multiplicity of the pending event of each shared pool (-1: none)
+    std::vector< std::vector<AliAODConversionPhoton> > fBGPhotonBuffers;          //! photons of the background events of the current pool, moved to the current vertex and event plane
+    Int_t                             fBGPhotonBufferPool;                        //! pool held in fBGPhotonBuffers for the current event (-1: none)
+    TList*                            fBGPoolInputList;                           //! list of the photons handed to AliGammaConversionAODBGHandler::AddEvent
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
 
@@ -307,7 +323,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 42);
+    ClassDef(AliAnalysisTaskGammaConvV1, 45);
 };
 
 #endif
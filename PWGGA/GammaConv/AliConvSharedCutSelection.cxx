@@ -0,0 +1,126 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Shared photon selection stages between
+// cut sets with identical stage settings
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "AliConvSharedCutSelection.h"
+#include "AliConversionPhotonCuts.h"
+#include "AliLog.h"
+
+//________________________________________________________________________
+AliConvSharedCutSelection::AliConvSharedCutSelection() :
+  fSlot(),
+  fNSlots(0),
+  fNCandidates(0),
+  fStatus(),
+  fFirstRecord(),
+  fNRecords(),
+  fRecordHisto(),
+  fRecordX(),
+  fRecordY(),
+  fRecordStart(0)
+{
+}
+
+//________________________________________________________________________
+void AliConvSharedCutSelection::Init(const std::vector<AliConversionPhotonCuts*> &cuts)
+{
+  // Assign a cache slot to each distinct stage key of the cut sets
+  const Int_t nCuts = cuts.size();
+  const Int_t nStages = AliConversionPhotonCuts::kNSelectionStages;
+  std::vector<TString> keys;
+  fSlot.assign(nCuts, std::vector<Int_t>(nStages, -1));
+  fNSlots = 0;
+  Bool_t isShared = kFALSE;
+  for(Int_t iCut = 0; iCut<nCuts; iCut++){
+    for(Int_t stage = 0; stage<nStages; stage++){
+      TString key = cuts[iCut]->GetSelectionStageKey(stage);
+      for(Int_t jCut = 0; jCut<iCut; jCut++){
+        if(keys[jCut*nStages+stage].CompareTo(key) == 0){
+          fSlot[iCut][stage] = fSlot[jCut][stage];
+          AliInfoGeneral("AliConvSharedCutSelection", Form("photon selection stage %d of cut set %d is shared with cut set %d", stage, iCut, jCut));
+          isShared = kTRUE;
+          break;
+        }
+      }
+      if(fSlot[iCut][stage] < 0) fSlot[iCut][stage] = fNSlots++;
+      keys.push_back(key);
+    }
+  }
+  // nothing to share, evaluate every cut set on its own
+  if(!isShared){
+    fSlot.clear();
+    fNSlots = 0;
+  }
+  fNCandidates = 0;
+  fStatus.clear();
+  fFirstRecord.clear();
+  fNRecords.clear();
+  fRecordHisto.clear();
+  fRecordX.clear();
+  fRecordY.clear();
+}
+
+//________________________________________________________________________
+void AliConvSharedCutSelection::NewEvent(Int_t nCandidates)
+{
+  // Forget the results of the previous event
+  if(!IsActive()) return;
+  fNCandidates = nCandidates;
+  fStatus.assign(fNSlots*fNCandidates, kNotEvaluated);
+  fFirstRecord.assign(fNSlots*fNCandidates, 0);
+  fNRecords.assign(fNSlots*fNCandidates, 0);
+  fRecordHisto.clear();
+  fRecordX.clear();
+  fRecordY.clear();
+}
+
+//________________________________________________________________________
+Bool_t AliConvSharedCutSelection::PhotonIsSelected(AliConversionPhotonCuts *cuts, Int_t iCut, AliConversionPhotonBase *photon, AliVEvent *event, Int_t candidate)
+{
+  // Photon selection of cut set iCut, reusing the stage decisions of earlier cut sets with the same stage settings
+  if(!IsActive()) return cuts->PhotonIsSelected(photon,event);
+  return cuts->PhotonIsSelected(photon,event,this,iCut,candidate);
+}
+
+//________________________________________________________________________
+void AliConvSharedCutSelection::RecordBookkeeping(Int_t histo, Double_t x, Double_t y)
+{
+  // Record a bookkeeping fill of the stage being evaluated
+  fRecordHisto.push_back(histo);
+  fRecordX.push_back(x);
+  fRecordY.push_back(y);
+}
+
+//________________________________________________________________________
+void AliConvSharedCutSelection::EndStage(Int_t iCut, Int_t stage, Int_t candidate, Bool_t passed)
+{
+  // Store the decision and the bookkeeping fills of the evaluated stage
+  Int_t index = Index(iCut,stage,candidate);
+  fStatus[index] = passed ? kAccepted : kRejected;
+  fFirstRecord[index] = fRecordStart;
+  fNRecords[index] = fRecordHisto.size() - fRecordStart;
+}
+
+//________________________________________________________________________
+void AliConvSharedCutSelection::ReplayStage(AliConversionPhotonCuts *cuts, Int_t iCut, Int_t stage, Int_t candidate) const
+{
+  // Fill the bookkeeping histograms of cut set iCut as the evaluation of the stage would have done
+  Int_t index = Index(iCut,stage,candidate);
+  for(Int_t iRecord = fFirstRecord[index]; iRecord < fFirstRecord[index]+fNRecords[index]; iRecord++)
+    cuts->FillBookkeeping(fRecordHisto[iRecord],fRecordX[iRecord],fRecordY[iRecord]);
+}
@@ -0,0 +1,61 @@
+#ifndef ALICONVSHAREDCUTSELECTION_H
+#define ALICONVSHAREDCUTSELECTION_H
+
+#include <Rtypes.h>
+#include <TString.h>
+#include <vector>
+
+class AliVEvent;
+class AliConversionPhotonBase;
+class AliConversionPhotonCuts;
+
+//____________________________________________________________________________
+// Per event cache of the photon selection stages of the cut sets of a task.
+// Each stage of AliConversionPhotonCuts::PhotonIsSelected() is keyed on the values
+// of all settings it depends on (AliConversionPhotonCuts::GetSelectionStageKey()),
+// including those set by setters instead of the cut string, so cut sets which agree
+// in a stage share its decision per candidate, even if their cut strings differ.
+// The bookkeeping fills of a stage are recorded when it is evaluated and replayed
+// into the histograms of every cut set reusing the decision. A stage is only reused
+// by cut sets which fill no other QA histograms in it, i.e. in light output mode.
+//____________________________________________________________________________
+class AliConvSharedCutSelection {
+  public:
+    enum ESelectionStatus {
+      kNotEvaluated = -1,
+      kRejected     = 0,
+      kAccepted     = 1
+    };
+
+    AliConvSharedCutSelection();
+    ~AliConvSharedCutSelection() {}
+
+    void    Init(const std::vector<AliConversionPhotonCuts*> &cuts);
+    Bool_t  IsActive() const                           { return fNSlots > 0; }
+    void    NewEvent(Int_t nCandidates);
+
+    Bool_t  PhotonIsSelected(AliConversionPhotonCuts *cuts, Int_t iCut, AliConversionPhotonBase *photon, AliVEvent *event, Int_t candidate);
+
+    // interface for AliConversionPhotonCuts
+    Int_t   GetStageStatus(Int_t iCut, Int_t stage, Int_t candidate) const { return fStatus[Index(iCut,stage,candidate)]; }
+    void    BeginStage()                               { fRecordStart = fRecordHisto.size(); }
+    void    RecordBookkeeping(Int_t histo, Double_t x, Double_t y);
+    void    EndStage(Int_t iCut, Int_t stage, Int_t candidate, Bool_t passed);
+    void    ReplayStage(AliConversionPhotonCuts *cuts, Int_t iCut, Int_t stage, Int_t candidate) const;
+
+  private:
+    Int_t   Index(Int_t iCut, Int_t stage, Int_t candidate) const { return fSlot[iCut][stage]*fNCandidates + candidate; }
+
+    std::vector< std::vector<Int_t> > fSlot;   // cache slot of each cut set and stage, identical for identical stage keys
+    Int_t                   fNSlots;           // number of distinct stage keys
+    Int_t                   fNCandidates;      // number of candidates in the current event
+    std::vector<Int_t>      fStatus;           // ESelectionStatus per (slot, candidate)
+    std::vector<Int_t>      fFirstRecord;      // first recorded bookkeeping fill per (slot, candidate)
+    std::vector<Int_t>      fNRecords;         // number of recorded bookkeeping fills per (slot, candidate)
+    std::vector<Int_t>      fRecordHisto;      // recorded bookkeeping fills: histogram id
+    std::vector<Double_t>   fRecordX;          // recorded bookkeeping fills: x value
+    std::vector<Double_t>   fRecordY;          // recorded bookkeeping fills: y value
+    Int_t                   fRecordStart;      // first record of the stage being evaluated
+};
+
+#endif
@@ -54,6 +54,7 @@
 #include "AliAODMCParticle.h"
 #include "AliAODMCHeader.h"
 #include "AliTRDTriggerAnalysis.h"
+#include "AliConvSharedCutSelection.h"
 
 class iostream;
 
@@ -220,6 +221,7 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fPreSelCut(kFALSE),
   fProcessAODCheck(kFALSE),
   fProfileContainingMaterialBudgetWeights(NULL),
+  fBookkeepingRecorder(NULL),
   fMaterialBudgetWeightsInitialized(kFALSE)
 {
   InitPIDResponse();
@@ -356,6 +358,7 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fPreSelCut(ref.fPreSelCut),
   fProcessAODCheck(ref.fProcessAODCheck),
   fProfileContainingMaterialBudgetWeights(ref.fProfileContainingMaterialBudgetWeights),
+  fBookkeepingRecorder(NULL),
   fMaterialBudgetWeightsInitialized(ref.fMaterialBudgetWeightsInitialized)
 {
   // Copy Constructor
@@ -807,7 +810,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelectedAODMC(AliAODMCParticle *particle
 Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVEvent *event){   // Specific Photon Cuts
 
   Int_t cutIndex = 0;
-  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt());
+  FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt());
   cutIndex++;
 
   // Fill Histos before Cuts
@@ -817,7 +820,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   // Gamma selection based on QT from Armenteros
   if(fDoQtGammaSelection == kTRUE){
     if(!ArmenterosQtCut(photon)){
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //1
+      FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //1
       return kFALSE;
     }
   }
@@ -826,7 +829,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   // Chi Cut
   if(photon->GetChi2perNDF() > fChi2CutConversion || photon->GetChi2perNDF() <=0){
     {
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //2
+      FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //2
       return kFALSE;
     }
   }
@@ -834,7 +837,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
 
   // Reconstruction Acceptance Cuts
   if(!AcceptanceCuts(photon)){
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //3
+    FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //3
     return kFALSE;
   }
 
@@ -842,7 +845,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   // Asymmetry Cut
   if(fDoPhotonAsymmetryCut == kTRUE){
     if(!AsymmetryCut(photon,event)){
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //4
+      FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //4
       return kFALSE;
     }
   }
@@ -850,13 +853,13 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   //Check the pid probability
   cutIndex++; //5
   if(!PIDProbabilityCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //5
+    FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //5
     return kFALSE;
   }
 
   cutIndex++; //6
   if(!CorrectedTPCClusterCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //6
+    FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //6
     return kFALSE;
   }
 
@@ -873,13 +876,13 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
 
   cutIndex++; //7
   if(!PsiPairCut(photon)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //7
+    FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //7
     return kFALSE;
   }
 
   cutIndex++; //8
   if(!CosinePAngleCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //8
+    FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //8
     return kFALSE;
   }
 
@@ -889,13 +892,13 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
 
     cutIndex++; //9
     if(photonAOD->GetDCArToPrimVtx() > fDCARPrimVtxCut) { //DCA R cut of photon to primary vertex
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //9
+      FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //9
       return kFALSE;
     }
 
     cutIndex++; //10
     if(TMath::Abs(photonAOD->GetDCAzToPrimVtx()) > fDCAZPrimVtxCut) { //DCA Z cut of photon to primary vertex
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //10
+      FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //10
       return kFALSE;
     }
   } else {
@@ -913,12 +916,12 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
         photonQuality = photonAOD->GetPhotonQuality();
       }
       if (fDoPhotonQualitySelectionCut && photonQuality != fPhotonQualityCut){
-        if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //11
+        FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //11
         return kFALSE;
       }
   } 
   cutIndex++; //12
-  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //11
+  FillBookkeeping(kBookkeepingPhotonCuts,cutIndex,photon->GetPhotonPt()); //11
 
   // Histos after Cuts
   if(fHistoInvMassafter)fHistoInvMassafter->Fill(photon->GetMass());
@@ -969,6 +972,14 @@ Bool_t AliConversionPhotonCuts::CorrectedTPCClusterCut(AliConversionPhotonBase *
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon, AliVEvent * event){
   //Selection of Reconstructed Photons
+  return PhotonIsSelected(photon,event,NULL,-1,-1);
+}
+
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon, AliVEvent * event, AliConvSharedCutSelection *sharedSelection, Int_t iCut, Int_t candidate){
+  //Selection of Reconstructed Photons
+  //With a shared selection, the decision of a selection stage is taken from an earlier cut set with
+  //identical settings for this stage, if the stage fills no QA histograms apart from the bookkeeping
 
   FillPhotonCutIndex(kPhotonIn);
 
@@ -989,44 +1000,28 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   }
 
   // check if V0 from AliAODGammaConversion.root is actually contained in AOD by checking if V0 exists with same tracks
-  if(event->IsA()==AliAODEvent::Class() && fPreSelCut && ( fIsHeavyIon != 1 || (fIsHeavyIon == 1 && fProcessAODCheck) )) {
-    AliAODEvent* aodEvent = dynamic_cast<AliAODEvent*>(event);
-
-    Bool_t bFound = kFALSE;
-    Int_t v0PosID = posTrack->GetID();
-    Int_t v0NegID = negTrack->GetID();
-    AliAODv0* v0 = NULL;
-    for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
-      v0 = aodEvent->GetV0(iV);
-      if(!v0) continue;
-      if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
-        bFound = kTRUE;
-        break;
-      }
-    }
-    if(!bFound){
-      FillPhotonCutIndex(kNoV0);
-      return kFALSE;
-    }
+  if(!SelectionStageIsPassed(kStageV0InAOD,photon,event,negTrack,posTrack,sharedSelection,iCut,candidate)){
+    FillPhotonCutIndex(kNoV0);
+    return kFALSE;
   }
 
   photon->DeterminePhotonQuality(negTrack,posTrack);
   // Track Cuts
-  if(!TracksAreSelected(negTrack, posTrack)){
+  if(!SelectionStageIsPassed(kStageTracks,photon,event,negTrack,posTrack,sharedSelection,iCut,candidate)){
     FillPhotonCutIndex(kTrackCuts);
     return kFALSE;
   }
   if (fHistoEtaDistV0s)fHistoEtaDistV0s->Fill(photon->GetPhotonEta());
   // dEdx Cuts
   
-  if(!KappaCuts(photon, event) || !dEdxCuts(negTrack) || !dEdxCuts(posTrack)) {
+  if(!SelectionStageIsPassed(kStagedEdx,photon,event,negTrack,posTrack,sharedSelection,iCut,candidate)) {
     FillPhotonCutIndex(kdEdxCuts);
     return kFALSE;
   }
     
   if (fHistoEtaDistV0sAfterdEdxCuts)fHistoEtaDistV0sAfterdEdxCuts->Fill(photon->GetPhotonEta());
   // Photon Cuts
-  if(!PhotonCuts(photon,event)){
+  if(!SelectionStageIsPassed(kStagePhoton,photon,event,negTrack,posTrack,sharedSelection,iCut,candidate)){
     FillPhotonCutIndex(kPhotonCuts);
     return kFALSE;
   }
@@ -1036,6 +1031,148 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   return kTRUE;
 }
 
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::EvaluateSelectionStage(Int_t stage, AliConversionPhotonBase *photon, AliVEvent *event, AliVTrack *negTrack, AliVTrack *posTrack){
+  // Evaluate one stage of PhotonIsSelected()
+
+  switch(stage){
+    case kStageV0InAOD:
+      if(event->IsA()==AliAODEvent::Class() && fPreSelCut && ( fIsHeavyIon != 1 || (fIsHeavyIon == 1 && fProcessAODCheck) )) {
+        AliAODEvent* aodEvent = dynamic_cast<AliAODEvent*>(event);
+
+        Int_t v0PosID = posTrack->GetID();
+        Int_t v0NegID = negTrack->GetID();
+        AliAODv0* v0 = NULL;
+        for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+          v0 = aodEvent->GetV0(iV);
+          if(!v0) continue;
+          if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
+            return kTRUE;
+          }
+        }
+        return kFALSE;
+      }
+      return kTRUE;
+    case kStageTracks:
+      return TracksAreSelected(negTrack, posTrack);
+    case kStagedEdx:
+      return (KappaCuts(photon, event) && dEdxCuts(negTrack) && dEdxCuts(posTrack));
+    case kStagePhoton:
+      return PhotonCuts(photon,event);
+    default:
+      return kFALSE;
+  }
+}
+
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::SelectionStageIsPassed(Int_t stage, AliConversionPhotonBase *photon, AliVEvent *event, AliVTrack *negTrack, AliVTrack *posTrack,
+                                                       AliConvSharedCutSelection *sharedSelection, Int_t iCut, Int_t candidate){
+  // Evaluate one stage of PhotonIsSelected(), or take its decision and bookkeeping from the shared selection
+
+  if(!sharedSelection || !sharedSelection->IsActive()) return EvaluateSelectionStage(stage,photon,event,negTrack,posTrack);
+
+  Int_t status = sharedSelection->GetStageStatus(iCut,stage,candidate);
+  if(status != AliConvSharedCutSelection::kNotEvaluated){
+    // the QA histograms apart from the bookkeeping can only be filled by evaluating the stage
+    if(!SelectionStageIsReusable(stage)) return EvaluateSelectionStage(stage,photon,event,negTrack,posTrack);
+    sharedSelection->ReplayStage(this,iCut,stage,candidate);
+    return (status == AliConvSharedCutSelection::kAccepted);
+  }
+
+  sharedSelection->BeginStage();
+  fBookkeepingRecorder = sharedSelection;
+  Bool_t passed = EvaluateSelectionStage(stage,photon,event,negTrack,posTrack);
+  fBookkeepingRecorder = NULL;
+  sharedSelection->EndStage(iCut,stage,candidate,passed);
+  return passed;
+}
+
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::SelectionStageIsReusable(Int_t stage) const {
+  // A stage decision of another cut set can be reused if the stage fills no QA histograms apart from
+  // the bookkeeping histograms, which are replayed (i.e. in light output mode)
+
+  switch(stage){
+    case kStageV0InAOD:
+    case kStageTracks:
+      return kTRUE;
+    case kStagedEdx:
+      return (!fHistoTPCdEdxSigbefore && !fHistoTPCdEdxbefore && !fHistoTOFbefore && !fHistoTOFSigbefore && !fHistoTOFSigafter &&
+              !fHistoITSSigbefore && !fHistoITSSigafter && !fHistoTPCdEdxSigafter && !fHistoTPCdEdxafter);
+    case kStagePhoton:
+      return (!fHistoInvMassbefore && !fHistoArmenterosbefore && !fHistoInvMassafter && !fHistoArmenterosafter &&
+              !fHistoPsiPairDeltaPhiafter && !fHistoKappaafter && !fHistoAsymmetryafter);
+    default:
+      return kFALSE;
+  }
+}
+
+///________________________________________________________________________
+TString AliConversionPhotonCuts::GetSelectionStageKey(Int_t stage){
+  // Key of all settings a selection stage depends on, including those which are not part of the cut string.
+  // Cut sets with the same key for a stage take the same decision in this stage.
+
+  TString key = Form("%d|%s|",stage,fV0ReaderName.Data());
+  switch(stage){
+    case kStageV0InAOD:
+      key += Form("%d|%d|%d",fPreSelCut,fIsHeavyIon,fProcessAODCheck);
+      break;
+    case kStageTracks:
+      key += Form("%d|%.17g|%.17g|%.17g|%d|%.17g|%.17g",
+                  fUseOnFlyV0FinderSameSign,fMinClsTPC,fEtaCut,fEtaCutMin,fDoAsymPtCut,fSinglePtCut,fSinglePtCut2);
+      break;
+    case kStagedEdx:
+      key += Form("%d|%.9g|%.9g|",fSwitchToKappa,fKappaMinCut,fKappaMaxCut);
+      key += Form("%d|%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|",fDodEdxSigmaCut,fPIDnSigmaBelowElectronLine,fPIDnSigmaAboveElectronLine,
+                  fPIDMinPnSigmaAbovePionLine,fPIDMaxPnSigmaAbovePionLine,fPIDnSigmaAbovePionLine,fPIDnSigmaAbovePionLineHighPt);
+      key += Form("%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|",fDoKaonRejectionLowP,fPIDMinPKaonRejectionLowP,fPIDnSigmaAtLowPAroundKaonLine,
+                  fDoProtonRejectionLowP,fPIDMinPProtonRejectionLowP,fPIDnSigmaAtLowPAroundProtonLine,
+                  fDoPionRejectionLowP,fPIDMinPPionRejectionLowP,fPIDnSigmaAtLowPAroundPionLine);
+      key += Form("%d|%.17g|%.17g|%d|%.17g|%.17g|%.17g|%d|%.17g",fUseTOFpid,fTofPIDnSigmaAboveElectronLine,fTofPIDnSigmaBelowElectronLine,
+                  fUseITSpid,fMaxPtPIDITS,fITSPIDnSigmaAboveElectronLine,fITSPIDnSigmaBelowElectronLine,fDoTRDPID,fPIDTRDEfficiency);
+      break;
+    case kStagePhoton:
+      key += Form("%d|%d|%.17g|%.17g|",fDoQtGammaSelection,fDo2DQt,fQtMax,fChi2CutConversion);
+      key += Form("%.17g|%.17g|%.17g|%.17g|%d|%.17g|%.17g|%.17g|%.17g|%.17g|",fMaxR,fMinR,fLineCutZRSlope,fLineCutZValue,
+                  fUseEtaMinCut,fLineCutZRSlopeMin,fLineCutZValueMin,fMaxZ,fEtaCut,fEtaCutMin);
+      key += Form("%d|%.9g|%.9g|%.9g|%.9g|%.17g|",fDoShrinkTPCAcceptance,fEtaForPhiCutMin,fEtaForPhiCutMax,fMinPhiCut,fMaxPhiCut,fPtCut);
+      key += Form("%d|%d|%.17g|%.17g|",fDoPhotonAsymmetryCut,fDoPhotonPDependentAsymCut,fMinPPhotonAsymmetryCut,fMinPhotonAsymmetry);
+      // the momentum dependent asymmetry cut is a function owned by each cut object
+      if(fDoPhotonAsymmetryCut && fDoPhotonPDependentAsymCut) key += Form("%p|",(void*)fFAsymmetryCut);
+      key += Form("%.17g|%.17g|%d|%.17g|",fPIDProbabilityCutNegativeParticle,fPIDProbabilityCutPositiveParticle,fUseCorrectedTPCClsInfo,fMinClsTPCToF);
+      key += Form("%.9g|%d|%d|%.9g|%.17g|%.17g|%d|%d",fPsiPairCut,fDo2DPsiPairChi2,fIncludeRejectedPsiPair,fCosPAngleCut,
+                  fDCARPrimVtxCut,fDCAZPrimVtxCut,fDoPhotonQualitySelectionCut,fPhotonQualityCut);
+      break;
+    default:
+      break;
+  }
+  return key;
+}
+
+///________________________________________________________________________
+void AliConversionPhotonCuts::FillBookkeeping(Int_t histo, Double_t x, Double_t y){
+  // Fill a bookkeeping histogram of the selection stages, and record the fill if the stage is
+  // evaluated for other cut sets as well
+
+  switch(histo){
+    case kBookkeepingTrackCuts:
+      if(fHistoTrackCuts)fHistoTrackCuts->Fill(x);
+      break;
+    case kBookkeepingdEdxCuts:
+      if(fHistodEdxCuts)fHistodEdxCuts->Fill(x,y);
+      break;
+    case kBookkeepingPhotonCuts:
+      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(x,y);
+      break;
+    case kBookkeepingAcceptanceCuts:
+      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(x,y);
+      break;
+    default:
+      break;
+  }
+  if(fBookkeepingRecorder) fBookkeepingRecorder->RecordBookkeeping(histo,x,y);
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::ArmenterosQtCut(AliConversionPhotonBase *photon){   // Armenteros Qt Cut
   if(fDo2DQt){
@@ -1056,45 +1193,45 @@ Bool_t AliConversionPhotonCuts::AcceptanceCuts(AliConversionPhotonBase *photon)
   // Exclude certain areas for photon reconstruction
 
   Int_t cutIndex=0;
-  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
   cutIndex++;
 
   if(photon->GetConversionRadius()>fMaxR){ // cuts on distance from collision point
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   cutIndex++;
 
   if(photon->GetConversionRadius()<fMinR){ // cuts on distance from collision point
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   cutIndex++;
 
   if(photon->GetConversionRadius() <= ((TMath::Abs(photon->GetConversionZ())*fLineCutZRSlope)-fLineCutZValue)){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   else if (fUseEtaMinCut &&  photon->GetConversionRadius() >= ((TMath::Abs(photon->GetConversionZ())*fLineCutZRSlopeMin)-fLineCutZValueMin )){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   cutIndex++;
 
   if(TMath::Abs(photon->GetConversionZ()) > fMaxZ ){ // cuts out regions where we do not reconstruct
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   cutIndex++;
 
 
   if( photon->GetPhotonEta() > (fEtaCut)    || photon->GetPhotonEta() < (-fEtaCut) ){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   if(fEtaCutMin>-0.1){
     if( photon->GetPhotonEta() < (fEtaCutMin) && photon->GetPhotonEta() > (-fEtaCutMin) ){
-      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+      FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
       return kFALSE;
     }
   }
@@ -1104,14 +1241,14 @@ Bool_t AliConversionPhotonCuts::AcceptanceCuts(AliConversionPhotonBase *photon)
     if(photon->GetPhotonEta() > fEtaForPhiCutMin && photon->GetPhotonEta() < fEtaForPhiCutMax ){
       if (fMinPhiCut < fMaxPhiCut){
         if( photon->GetPhotonPhi() > fMinPhiCut && photon->GetPhotonPhi() < fMaxPhiCut ) {
-          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+          FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
           return kFALSE;
         }
       } else {
         Double_t photonPhi = photon->GetPhotonPhi();
         if (photon->GetPhotonPhi() < TMath::Pi()) photonPhi = photon->GetPhotonPhi() + 2*TMath::Pi();
         if( photonPhi > fMinPhiCut && photonPhi < fMaxPhiCut+2*TMath::Pi() ) {
-          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+          FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
           return kFALSE;
         }
       }
@@ -1122,12 +1259,12 @@ Bool_t AliConversionPhotonCuts::AcceptanceCuts(AliConversionPhotonBase *photon)
 
   
   if(photon->GetPhotonPt()<fPtCut){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+    FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
     return kFALSE;
   }
   cutIndex++;
 
-  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  FillBookkeeping(kBookkeepingAcceptanceCuts,cutIndex,photon->GetPhotonPt());
 
   return kTRUE;
 }
@@ -1138,7 +1275,7 @@ Bool_t AliConversionPhotonCuts::SpecificTrackCuts(AliAODTrack * negTrack, AliAOD
   // Track Cuts which require AOD/ESD specific implementation
 
   if( !negTrack->IsOn(AliESDtrack::kTPCrefit)  || !posTrack->IsOn(AliESDtrack::kTPCrefit)   )  {
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   cutIndex++;
@@ -1146,7 +1283,7 @@ Bool_t AliConversionPhotonCuts::SpecificTrackCuts(AliAODTrack * negTrack, AliAOD
   AliAODVertex * NegVtxType=negTrack->GetProdVertex();
   AliAODVertex * PosVtxType=posTrack->GetProdVertex();
   if( (NegVtxType->GetType())==AliAODVertex::kKink || (PosVtxType->GetType())==AliAODVertex::kKink) {
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   return kTRUE;
@@ -1159,13 +1296,13 @@ Bool_t AliConversionPhotonCuts::SpecificTrackCuts(AliESDtrack * negTrack, AliESD
   // Track Cuts which require AOD/ESD specific implementation
 
   if( !negTrack->IsOn(AliESDtrack::kTPCrefit)  || !posTrack->IsOn(AliESDtrack::kTPCrefit)   )  {
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   cutIndex++;
 
   if(negTrack->GetKinkIndex(0) > 0  || posTrack->GetKinkIndex(0) > 0 ) {
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   return kTRUE;
@@ -1178,18 +1315,18 @@ Bool_t AliConversionPhotonCuts::TracksAreSelected(AliVTrack * negTrack, AliVTrac
   // Track Selection for Photon Reconstruction
 
   Int_t cutIndex=0;
-  if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+  FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
   cutIndex++;
 
   // avoid like sign
   if(fUseOnFlyV0FinderSameSign==0){
     if(negTrack->Charge() == posTrack->Charge()) {
-      if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+      FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
       return kFALSE;
     }
   }else if(fUseOnFlyV0FinderSameSign==1){
     if(negTrack->Charge() != posTrack->Charge()) {
-      if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+      FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
       return kFALSE;
     }
   }
@@ -1199,7 +1336,7 @@ Bool_t AliConversionPhotonCuts::TracksAreSelected(AliVTrack * negTrack, AliVTrac
 
 
   if( negTrack->GetNcls(1) < fMinClsTPC || posTrack->GetNcls(1) < fMinClsTPC ) {
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   cutIndex++;
@@ -1207,13 +1344,13 @@ Bool_t AliConversionPhotonCuts::TracksAreSelected(AliVTrack * negTrack, AliVTrac
   // Acceptance
   if( posTrack->Eta() > (fEtaCut) || posTrack->Eta() < (-fEtaCut) ||
     negTrack->Eta() > (fEtaCut) || negTrack->Eta() < (-fEtaCut) ){
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   if(fEtaCutMin>-0.1){
     if( (posTrack->Eta() < (fEtaCutMin) && posTrack->Eta() > (-fEtaCutMin)) ||
       (negTrack->Eta() < (fEtaCutMin) && negTrack->Eta() > (-fEtaCutMin)) ){
-      if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+      FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
       return kFALSE;
     }
   }
@@ -1222,12 +1359,12 @@ Bool_t AliConversionPhotonCuts::TracksAreSelected(AliVTrack * negTrack, AliVTrac
   // Single Pt Cut
   if(fDoAsymPtCut){
     if((posTrack->Pt()<fSinglePtCut || negTrack->Pt()<fSinglePtCut2) && (posTrack->Pt()<fSinglePtCut2 || negTrack->Pt()<fSinglePtCut) ){
-      if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+      FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
       return kFALSE;
     }
   } else {
     if(posTrack->Pt()<fSinglePtCut || negTrack->Pt()<fSinglePtCut){
-      if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+      FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
       return kFALSE;
     }
   }
@@ -1243,12 +1380,12 @@ Bool_t AliConversionPhotonCuts::TracksAreSelected(AliVTrack * negTrack, AliVTrac
   }
 
   if(!passCuts){
-    if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+    FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
     return kFALSE;
   }
   cutIndex++;
 
-  if(fHistoTrackCuts)fHistoTrackCuts->Fill(cutIndex);
+  FillBookkeeping(kBookkeepingTrackCuts,cutIndex);
 
   return kTRUE;
 
@@ -1277,7 +1414,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
   Int_t cutIndex=0;
-  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
   if(fHistoTPCdEdxSigbefore)fHistoTPCdEdxSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTPC(fCurrentTrack, AliPID::kElectron));
   if(fHistoTPCdEdxbefore)fHistoTPCdEdxbefore->Fill(fCurrentTrack->P(),fCurrentTrack->GetTPCsignal());
   cutIndex++;
@@ -1286,7 +1423,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if( fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron)<fPIDnSigmaBelowElectronLine ||
       fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron)>fPIDnSigmaAboveElectronLine){
 
-      if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+      FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
       return kFALSE;
     }
     cutIndex++;
@@ -1297,7 +1434,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
         fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron)<fPIDnSigmaAboveElectronLine&&
         fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
 
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1309,7 +1446,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
         fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron)<fPIDnSigmaAboveElectronLine &&
         fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
 
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1321,7 +1458,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
       if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
 
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1331,7 +1468,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
       if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
 
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1342,7 +1479,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
       if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
 
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1376,7 +1513,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if(fUseTOFpid){
       if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
         fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+        FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
@@ -1389,7 +1526,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
     if(fUseITSpid){
       if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
         if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+          FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       }
@@ -1402,13 +1539,13 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack){
   // Apply TRD PID
   if(fDoTRDPID){
     if(!fPIDResponse->IdentifiedAsElectronTRD(fCurrentTrack,fPIDTRDEfficiency)){
-      if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+      FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
       return kFALSE;
     }
   }
   cutIndex++;
 
-  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  FillBookkeeping(kBookkeepingdEdxCuts,cutIndex,fCurrentTrack->Pt());
   if(fHistoTPCdEdxSigafter)fHistoTPCdEdxSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTPC(fCurrentTrack, AliPID::kElectron));
   if(fHistoTPCdEdxafter)fHistoTPCdEdxafter->Fill(fCurrentTrack->P(),fCurrentTrack->GetTPCsignal());
   
@@ -31,6 +31,7 @@ class iostream;
 class TList;
 class AliAnalysisManager;
 class AliAODMCParticle;
+class AliConvSharedCutSelection;
 
 /**
  * @class AliConversionPhotonCuts
@@ -119,6 +120,23 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
         kPhotonOut
     };
 
+    /// Selection stages of PhotonIsSelected() which can be shared between cut sets (see AliConvSharedCutSelection)
+    enum photonSelectionStages {
+        kStageV0InAOD=0,      ///< V0 of AliAODGammaConversion.root also contained in the AOD
+        kStageTracks,         ///< track cuts
+        kStagedEdx,           ///< kappa and electron PID cuts
+        kStagePhoton,         ///< photon specific cuts
+        kNSelectionStages
+    };
+
+    /// Bookkeeping histograms filled by the selection stages
+    enum bookkeepingHistos {
+        kBookkeepingTrackCuts=0,
+        kBookkeepingdEdxCuts,
+        kBookkeepingPhotonCuts,
+        kBookkeepingAcceptanceCuts
+    };
+
 
     Bool_t SetCutIds(TString cutString);
     Int_t fCuts[kNCuts];
@@ -155,6 +173,10 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     
     // Cut Selection
     Bool_t PhotonIsSelected(AliConversionPhotonBase * photon, AliVEvent  * event);
+    Bool_t PhotonIsSelected(AliConversionPhotonBase * photon, AliVEvent  * event, AliConvSharedCutSelection *sharedSelection, Int_t iCut, Int_t candidate);
+    TString GetSelectionStageKey(Int_t stage);
+    Bool_t SelectionStageIsReusable(Int_t stage) const;
+    void FillBookkeeping(Int_t histo, Double_t x, Double_t y = 0.);
     Bool_t PhotonIsSelectedMC(TParticle *particle,AliMCEvent *mcEvent,Bool_t checkForConvertedGamma=kTRUE);
     Bool_t PhotonIsSelectedAODMC(AliAODMCParticle *particle,TClonesArray *aodmcArray,Bool_t checkForConvertedGamma=kTRUE);
     //Bool_t ElectronIsSelectedMC(TParticle *particle,AliMCEvent *mcEvent);
@@ -382,10 +404,15 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t            fPreSelCut;                           ///< Flag for preselection cut used in V0Reader
     Bool_t            fProcessAODCheck;                     ///< Flag for processing check for AOD to be contained in AliAODs.root and AliAODGammaConversion.root
     TProfile*         fProfileContainingMaterialBudgetWeights;      
+    AliConvSharedCutSelection* fBookkeepingRecorder;        //!<! records the bookkeeping fills of the selection stage currently evaluated for other cut sets
+
+    Bool_t SelectionStageIsPassed(Int_t stage, AliConversionPhotonBase *photon, AliVEvent *event, AliVTrack *negTrack, AliVTrack *posTrack,
+                                  AliConvSharedCutSelection *sharedSelection, Int_t iCut, Int_t candidate);
+    Bool_t EvaluateSelectionStage(Int_t stage, AliConversionPhotonBase *photon, AliVEvent *event, AliVTrack *negTrack, AliVTrack *posTrack);
 
   private:
     /// \cond CLASSIMP
-    ClassDef(AliConversionPhotonCuts,15)
+    ClassDef(AliConversionPhotonCuts,16)
     /// \endcond
 };
 
@@ -23,6 +23,7 @@
 #pragma link C++ class AliDalitzElectronCuts+;
 #pragma link C++ class AliDalitzElectronSelector+;
 #pragma link C++ class AliCaloTrackMatcher+;
+#pragma link C++ class AliConvSharedCutSelection+;
 
 // User tasks
 #pragma link C++ class AliAnalysisTaskPi0v2+;
@@ -1418,6 +1418,13 @@ if(!fmult)
     
 } //end the exec
 
+//________________________________________________________________________
+void AliAnalysisTaskDStarCorrelations::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskDStarCorrelations::Terminate(Option_t*)
 {    
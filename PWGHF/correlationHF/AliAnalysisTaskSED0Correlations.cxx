@@ -1260,6 +1260,13 @@ void AliAnalysisTaskSED0Correlations::FillMassHists(AliAODRecoDecayHF2Prong *par
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSED0Correlations::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSED0Correlations::Terminate(Option_t */*option*/)
 {
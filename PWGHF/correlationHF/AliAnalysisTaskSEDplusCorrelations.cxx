@@ -1923,6 +1923,13 @@ Bool_t AliAnalysisTaskSEDplusCorrelations::AcceptTrackForMEOffline(Double_t Trac
 }
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDplusCorrelations::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //____________________| Terminate
 void AliAnalysisTaskSEDplusCorrelations::Terminate(Option_t *) {
     
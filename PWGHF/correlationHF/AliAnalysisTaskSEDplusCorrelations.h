@@ -47,6 +47,7 @@ class AliAnalysisTaskSEDplusCorrelations : public AliAnalysisTaskSE
     virtual void LocalInit() {Init();}
     virtual void UserExec(Option_t *option);
     virtual void Terminate(Option_t *option);
+    virtual void FinishTaskOutput();
     
     // Setters.
     void SetCorrFormPart(Bool_t genMC){fMCParticle=genMC;}
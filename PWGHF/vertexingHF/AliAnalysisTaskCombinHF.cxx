@@ -1402,7 +1402,8 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
 //_________________________________________________________________
 void AliAnalysisTaskCombinHF::FinishTaskOutput()
 {
-  /// perform mixed event analysis
+  /// flush the cached normalization counts and perform mixed event analysis
+  if(fCounter) fCounter->FlushCounts();
   if(fDoEventMixing==0) return;
   printf("AliAnalysisTaskCombinHF: FinishTaskOutput\n");
 
@@ -473,6 +473,13 @@ void AliAnalysisTaskSEB0toDStarPi::UserExec(Option_t *){
   //==================================================================================
 
 }
+//________________________________________________________________________
+void AliAnalysisTaskSEB0toDStarPi::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSEB0toDStarPi::Terminate(Option_t*){    
   /// The Terminate() function is the last function to be called during
@@ -46,6 +46,7 @@ class AliAnalysisTaskSEB0toDStarPi : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
  
   // histos
   void     DefineHistograms();
@@ -1011,6 +1011,13 @@ void AliAnalysisTaskSEB0toDminuspi::UserExec(Option_t *)
   PostData(3,fCounter);
 
 }
+//________________________________________________________________________
+void AliAnalysisTaskSEB0toDminuspi::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSEB0toDminuspi::Terminate(Option_t*)
 {    
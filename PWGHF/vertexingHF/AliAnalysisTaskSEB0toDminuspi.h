@@ -45,6 +45,7 @@ class AliAnalysisTaskSEB0toDminuspi : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
  
 
     // histos
@@ -42,6 +42,7 @@ class AliAnalysisTaskSECharmFraction : public AliAnalysisTaskSE {
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);  
+  virtual void FinishTaskOutput();
   void SetReadMC(Bool_t readMC=kTRUE){fReadMC=readMC;}
   void SetSplitMassD0D0bar(Bool_t splitD0D0bar=kTRUE){fsplitMassD0D0bar=splitD0D0bar;}
   Bool_t GetIsSplitMassD0D0bar(){return fsplitMassD0D0bar;}
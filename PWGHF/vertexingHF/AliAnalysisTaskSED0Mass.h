@@ -43,6 +43,7 @@ class AliAnalysisTaskSED0Mass : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
 
   void CreateMCAcceptanceHistos();
   Bool_t CheckAcc(TClonesArray* arrayMC,Int_t nProng, Int_t *labDau);
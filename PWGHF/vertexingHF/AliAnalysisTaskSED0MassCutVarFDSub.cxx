@@ -2366,6 +2366,13 @@ AliAODVertex* AliAnalysisTaskSED0MassCutVarFDSub::GetPrimaryVtxSkipped(AliAODEve
 }
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSED0MassCutVarFDSub::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSED0MassCutVarFDSub::Terminate(Option_t */*option*/)
 {
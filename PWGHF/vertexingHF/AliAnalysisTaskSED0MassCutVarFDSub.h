@@ -40,6 +40,7 @@ class AliAnalysisTaskSED0MassCutVarFDSub : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
 
   void SetArray(Int_t type=AliAnalysisTaskSED0MassCutVarFDSub::kD0){fArray=type;}
   enum{kD0,kLS};
@@ -3291,6 +3291,13 @@ AliAODVertex* AliAnalysisTaskSED0MassNonPromptFraction::GetPrimaryVtxSkipped(Ali
 }
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSED0MassNonPromptFraction::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSED0MassNonPromptFraction::Terminate(Option_t */*option*/)
 {
@@ -1289,6 +1289,13 @@ void AliAnalysisTaskSEDStarCharmFraction::FillTrueImpactParameter(AliAODRecoCasc
   hImpParTrue->Fill(fTrueImpParForTree);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDStarCharmFraction::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 void AliAnalysisTaskSEDStarCharmFraction::Terminate(const Option_t*)
 { // Terminate
 }
@@ -37,6 +37,7 @@ class AliAnalysisTaskSEDStarCharmFraction : public AliAnalysisTaskSE {
     virtual void LocalInit() {Init();}
     virtual void UserExec(Option_t *option);
     virtual void Terminate(Option_t *option);
+    virtual void FinishTaskOutput();
 
     void SetReadMC(Bool_t readMC = kTRUE) { fReadMC = readMC; }
     Bool_t GetReadMC() { return fReadMC; }
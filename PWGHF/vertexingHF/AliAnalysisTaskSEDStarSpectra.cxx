@@ -522,6 +522,13 @@ void AliAnalysisTaskSEDStarSpectra::UserExec(Option_t *)
   PostData(5,fCounter);
 
 }
+//________________________________________________________________________
+void AliAnalysisTaskSEDStarSpectra::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSEDStarSpectra::Terminate(Option_t*)
 {    
@@ -43,6 +43,7 @@ class AliAnalysisTaskSEDStarSpectra : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
 
 
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
@@ -94,6 +94,7 @@ class AliAnalysisTaskSEDplus : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
 
  private:
 
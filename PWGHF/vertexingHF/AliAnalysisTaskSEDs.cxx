@@ -1507,6 +1507,13 @@ void AliAnalysisTaskSEDs::UserExec(Option_t */*option*/)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDs::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //_________________________________________________________________
 
 void AliAnalysisTaskSEDs::Terminate(Option_t */*option*/)
@@ -80,6 +80,7 @@ class AliAnalysisTaskSEDs : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
     
  private:
   Int_t GetHistoIndex(Int_t iPtBin) const { return iPtBin*4;}
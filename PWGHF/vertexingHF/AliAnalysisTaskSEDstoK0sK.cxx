@@ -840,6 +840,13 @@ void AliAnalysisTaskSEDstoK0sK::UserExec(Option_t* /*option*/)
 
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDstoK0sK::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //__________________________________________________________________________
 void AliAnalysisTaskSEDstoK0sK::Terminate(Option_t* /*option*/)
 {
@@ -54,6 +54,7 @@ public:
    virtual void UserCreateOutputObjects();
    virtual void UserExec(Option_t* /*option*/);
    virtual void Terminate(Option_t* /*option*/);
+   virtual void FinishTaskOutput();
 
 
    // Setters
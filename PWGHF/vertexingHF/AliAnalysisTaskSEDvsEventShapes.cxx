@@ -1261,6 +1261,15 @@ void AliAnalysisTaskSEDvsEventShapes::CreateImpactParameterHistos()
     }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDvsEventShapes::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counters to their counter collections before the output is written
+  if(fCounterC) fCounterC->FlushCounts();
+  if(fCounterU) fCounterU->FlushCounts();
+  if(fCounterCandidates) fCounterCandidates->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSEDvsEventShapes::Terminate(Option_t */*option*/)
 {
@@ -140,6 +140,7 @@ public:
     virtual void LocalInit() {Init();}
     virtual void UserExec(Option_t *option);
     virtual void Terminate(Option_t *option);
+    virtual void FinishTaskOutput();
     
 private:
     
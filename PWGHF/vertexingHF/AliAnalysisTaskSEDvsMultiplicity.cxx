@@ -1274,6 +1274,15 @@ void AliAnalysisTaskSEDvsMultiplicity::CreateImpactParameterHistos(){
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEDvsMultiplicity::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counters to their counter collections before the output is written
+  if(fCounterC) fCounterC->FlushCounts();
+  if(fCounterU) fCounterU->FlushCounts();
+  if(fCounterCandidates) fCounterCandidates->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSEDvsMultiplicity::Terminate(Option_t */*option*/)
 {
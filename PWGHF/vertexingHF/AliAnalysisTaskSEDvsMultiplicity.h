@@ -145,6 +145,7 @@ class AliAnalysisTaskSEDvsMultiplicity : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
     
  private:
 
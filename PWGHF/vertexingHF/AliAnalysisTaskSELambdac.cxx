@@ -1581,6 +1581,13 @@ void AliAnalysisTaskSELambdac::UserExec(Option_t */*option*/)
 
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSELambdac::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSELambdac::Terminate(Option_t */*option*/)
 {
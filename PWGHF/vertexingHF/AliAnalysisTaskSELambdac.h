@@ -79,6 +79,7 @@ class AliAnalysisTaskSELambdac : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
     
  private:
 
@@ -1179,6 +1179,13 @@ void AliAnalysisTaskSELambdacTMVA::UserExec(Option_t */*option*/)
 
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSELambdacTMVA::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSELambdacTMVA::Terminate(Option_t */*option*/)
 {
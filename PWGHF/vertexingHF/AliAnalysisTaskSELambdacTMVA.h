@@ -100,6 +100,7 @@ class AliAnalysisTaskSELambdacTMVA : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
     
  private:
 
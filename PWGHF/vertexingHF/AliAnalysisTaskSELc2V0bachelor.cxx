@@ -393,6 +393,13 @@ void AliAnalysisTaskSELc2V0bachelor::UserExec(Option_t *)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSELc2V0bachelor::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSELc2V0bachelor::Terminate(Option_t*)
 {
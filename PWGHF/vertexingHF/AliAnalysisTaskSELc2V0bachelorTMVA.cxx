@@ -431,6 +431,13 @@ void AliAnalysisTaskSELc2V0bachelorTMVA::Init() {
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSELc2V0bachelorTMVA::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSELc2V0bachelorTMVA::Terminate(Option_t*)
 {
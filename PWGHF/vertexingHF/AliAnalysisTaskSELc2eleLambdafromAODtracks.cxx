@@ -1551,6 +1551,13 @@ void AliAnalysisTaskSELc2eleLambdafromAODtracks::UserExec(Option_t *)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSELc2eleLambdafromAODtracks::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSELc2eleLambdafromAODtracks::Terminate(Option_t*)
 {    
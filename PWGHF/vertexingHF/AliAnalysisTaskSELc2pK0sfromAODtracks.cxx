@@ -567,6 +567,13 @@ void AliAnalysisTaskSELc2pK0sfromAODtracks::UserExec(Option_t *)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSELc2pK0sfromAODtracks::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSELc2pK0sfromAODtracks::Terminate(Option_t*)
 {    
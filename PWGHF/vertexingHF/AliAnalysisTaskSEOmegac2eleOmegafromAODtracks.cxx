@@ -534,6 +534,13 @@ void AliAnalysisTaskSEOmegac2eleOmegafromAODtracks::UserExec(Option_t *)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEOmegac2eleOmegafromAODtracks::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSEOmegac2eleOmegafromAODtracks::Terminate(Option_t*)
 {    
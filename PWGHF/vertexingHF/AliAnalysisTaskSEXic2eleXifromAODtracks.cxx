@@ -1057,6 +1057,13 @@ void AliAnalysisTaskSEXic2eleXifromAODtracks::UserExec(Option_t *)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEXic2eleXifromAODtracks::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________ terminate ___________________________
 void AliAnalysisTaskSEXic2eleXifromAODtracks::Terminate(Option_t*)
 {    
@@ -45,6 +45,11 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+const char* AliNormalizationCounter::fgkEventTypeNames[AliNormalizationCounter::kNEventTypes]={
+  "triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV","countForNorm",
+  "noPrimaryV","zvtxGT10","!V0A&Candle03","!V0A&PrimaryV","Candid(Filter)","Candid(Analysis)",
+  "NCandid(Filter)","NCandid(Analysis)"};
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -57,7 +62,13 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fCacheCounts(),
+fCacheOrder(),
+fCacheNFilled(0),
+fCacheRun(-1),
+fCacheNMult(0),
+fCacheNSph(0)
 {
   // empty constructor
 }
@@ -74,7 +85,13 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fCacheCounts(),
+fCacheOrder(),
+fCacheNFilled(0),
+fCacheRun(-1),
+fCacheNMult(0),
+fCacheNSph(0)
 {
   ;
 }
@@ -148,6 +165,8 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
+  FlushCounts();
+  const_cast<AliNormalizationCounter*>(norm)->FlushCounts();
   fCounters.Add(&(norm->fCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
@@ -186,7 +205,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   //event must be either physics or MC
   if(!(event->GetEventType() == 7||event->GetEventType() == 0))return;
   
-  FillCounters("triggered",runNumber,multiplicity,spherocity);
+  FillCounters(kTriggered,runNumber,multiplicity,spherocity);
 
   //Find V0AND
   AliTriggerAnalysis trAn; /// Trigger Analysis
@@ -197,7 +216,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
     v0B = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0C);
     v0A = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0A);
   }
-  if(v0A&&v0B) FillCounters("V0AND",runNumber,multiplicity,spherocity);
+  if(v0A&&v0B) FillCounters(kV0AND,runNumber,multiplicity,spherocity);
   
   //FindPrimary vertex  
   // AliVVertex *vtrc =  (AliVVertex*)event->GetPrimaryVertex();
@@ -210,30 +229,30 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   AliAODEvent *eventAOD = (AliAODEvent*)event;
   TString trigclass=eventAOD->GetFiredTriggerClasses();
   if(trigclass.Contains("C0SMH-B-NOPF-ALLNOTRD")||trigclass.Contains("C0SMH-B-NOPF-ALL")){
-    FillCounters("PbPbC0SMH-B-NOPF-ALLNOTRD",runNumber,multiplicity,spherocity);
+    FillCounters(kPbPbC0SMH,runNumber,multiplicity,spherocity);
   }
 
   //FindPrimary vertex  
   if(isEventSelected){
-    FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
     flagPV=kTRUE;
   }else{
     if(rdCut->GetWhyRejection()==0){
-      FillCounters("noPrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kNoPrimaryV,runNumber,multiplicity,spherocity);
     }
     //find good vtx outside range
     if(rdCut->GetWhyRejection()==6){
-      FillCounters("zvtxGT10",runNumber,multiplicity,spherocity);
-      FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kZvtxGT10,runNumber,multiplicity,spherocity);
+      FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
       flagPV=kTRUE;
     }
     if(rdCut->GetWhyRejection()==1){
-      FillCounters("PileUp",runNumber,multiplicity,spherocity);
+      FillCounters(kPileUp,runNumber,multiplicity,spherocity);
     }
   }
   //to be counted for normalization
   if(rdCut->CountEventForNormalization()){
-    FillCounters("countForNorm",runNumber,multiplicity,spherocity);
+    FillCounters(kCountForNorm,runNumber,multiplicity,spherocity);
   }
 
 
@@ -242,17 +261,17 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   for(Int_t i=0;i<trkEntries&&!flag03;i++){
     AliAODTrack *track=(AliAODTrack*)event->GetTrack(i);
     if((track->Pt()>0.3)&&(!flag03)){
-      FillCounters("Candles0.3",runNumber,multiplicity,spherocity);
+      FillCounters(kCandles03,runNumber,multiplicity,spherocity);
       flag03=kTRUE;
       break;
     }
   }
   
   if(!(v0A&&v0B)&&(flag03)){ 
-    FillCounters("!V0A&Candle03",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0ACandle03,runNumber,multiplicity,spherocity);
   }
   if(!(v0A&&v0B)&&flagPV){
-    FillCounters("!V0A&PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0APrimaryV,runNumber,multiplicity,spherocity);
   }
   
   return;
@@ -278,36 +297,21 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   else fHistTrackAnaSpdMult->Fill(nSPD,nCand);
   
   Int_t runNumber = event->GetRunNumber();
-  Int_t multiplicity = Multiplicity(event);
   if(nCand==0)return;
+  Int_t multiplicity = fMultiplicity ? Multiplicity(event) : 0;
   if(flagFilter){
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber));
-    }
+    CountEvent(kCandidFilter,runNumber,multiplicity,kFALSE,0);
+    CountEvent(kNCandidFilter,runNumber,multiplicity,kFALSE,0,nCand);
   }else{
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber));
-    }
+    CountEvent(kCandidAnalysis,runNumber,multiplicity,kFALSE,0);
+    CountEvent(kNCandidAnalysis,runNumber,multiplicity,kFALSE,0,nCand);
   }
   return;
 }
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
   //
+  FlushCounts();
   fCounters.SortRubric("Run");
   TString selection;
   selection.Form("event:%s",candle.Data());
@@ -320,6 +324,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
   //
+  FlushCounts();
   fCounters.SortRubric("Run");
   TString name;
 
@@ -337,10 +342,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  FlushCounts();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  FlushCounts();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -372,6 +379,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -395,6 +403,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
     return 0.;
   }
 
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
 
   Int_t nmultbins = maxmultiplicity - minmultiplicity;
@@ -426,6 +435,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
     return 0.;
   }
 
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
   TString listofruns2 = fCounters.GetKeyWords("Spherocity");
   TObjArray* arr=listofruns2.Tokenize(",");
@@ -467,6 +477,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
     return 0.;
   }
 
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("Spherocity");
   TObjArray* arr=listofruns.Tokenize(",");
   Int_t nSphVals=arr->GetEntries();
@@ -503,6 +514,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
     return 0.;
   }
 
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
   Double_t sum=0.;
   for (Int_t ibin=minmultiplicity; ibin<=maxmultiplicity; ibin++) {
@@ -521,6 +533,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
   //usare algebra histos
+  FlushCounts();
   fCounters.SortRubric("Run");
   TString selection;
 
@@ -575,17 +588,109 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 }
 
 //___________________________________________________________________________
-void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
-
+void AliNormalizationCounter::FillCounters(Int_t eventType, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
 
   Int_t sphToInteger=spherocity*fSpherocitySteps;
-  if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
-  else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
-  else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
+  CountEvent(eventType,runNumber,multiplicity,kTRUE,sphToInteger);
+  return;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::CountEvent(Int_t eventType, Int_t runNumber, Int_t multiplicity, Bool_t useSpherocity, Int_t sphToInteger, Int_t nCounts){
+  // Accumulates the counts of one key of the current run in a dense array
+  // instead of formatting the key string for each event. Keys outside the
+  // cached ranges go straight to fCounters. See FlushCounts().
+
+  if(fCacheCounts.GetSize()==0){
+    fCacheNMult = fMultiplicity ? 256 : 1;
+    fCacheNSph = fSpherocity ? (Int_t)fSpherocitySteps+2 : 1;
+    fCacheCounts.Set(kNEventTypes*fCacheNMult*fCacheNSph);
+    fCacheOrder.Set(fCacheCounts.GetSize());
+    fCacheNFilled=0;
+  }
+  if(runNumber!=fCacheRun){
+    FlushCounts();
+    fCacheRun=runNumber;
+  }
+
+  const Int_t maxCachedMult=1000;
+  Int_t multSlot=0;
+  if(fMultiplicity){
+    if(multiplicity<0 || multiplicity>=maxCachedMult){
+      // rare values (e.g. the -9999 default) are counted directly, after the
+      // pending counts to keep the order of the keys
+      FlushCounts();
+      CountKey(eventType,runNumber,multiplicity,useSpherocity,sphToInteger,nCounts);
+      return;
+    }
+    if(multiplicity>=fCacheNMult){
+      FlushCounts();
+      fCacheNMult=TMath::Min(maxCachedMult,TMath::Max(2*fCacheNMult,multiplicity+1));
+      fCacheCounts.Set(kNEventTypes*fCacheNMult*fCacheNSph);
+      fCacheOrder.Set(fCacheCounts.GetSize());
+    }
+    multSlot=multiplicity;
+  }
+  Int_t sphSlot=0;
+  if(fSpherocity && useSpherocity){
+    if(sphToInteger<0 || sphToInteger+1>=fCacheNSph){
+      FlushCounts();
+      CountKey(eventType,runNumber,multiplicity,useSpherocity,sphToInteger,nCounts);
+      return;
+    }
+    sphSlot=sphToInteger+1;
+  }
+
+  Int_t slot=(eventType*fCacheNMult+multSlot)*fCacheNSph+sphSlot;
+  if(fCacheCounts[slot]==0) fCacheOrder[fCacheNFilled++]=slot;
+  fCacheCounts[slot]+=nCounts;
+  return;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::CountKey(Int_t eventType, Int_t runNumber, Int_t multiplicity, Bool_t useSpherocity, Int_t sphToInteger, Int_t nCounts){
+  // Counts nCounts times the key of the given event type in fCounters, with
+  // unit fills as when counting event by event
+
+  const char* name=fgkEventTypeNames[eventType];
+  Bool_t spherocity = fSpherocity && useSpherocity;
+  TString key;
+  if(fMultiplicity  && !spherocity) 
+    key.Form("Event:%s/Run:%d/Multiplicity:%d",name,runNumber,multiplicity);
+  else if(fMultiplicity  && spherocity) 
+    key.Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name,runNumber,multiplicity,sphToInteger);
+  else if(!fMultiplicity  && spherocity) 
+    key.Form("Event:%s/Run:%d/Spherocity:%d",name,runNumber,sphToInteger);
   else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
+    key.Form("Event:%s/Run:%d",name,runNumber);
+  for(Int_t i=0;i<nCounts;i++) fCounters.Count(key.Data());
   return;
 }
+
+//___________________________________________________________________________
+void AliNormalizationCounter::FlushCounts(){
+  // Moves the cached counts into fCounters. Keys are counted in the order
+  // they first appeared, so the keywords of the rubrics are registered in
+  // the same order as when counting event by event.
+
+  for(Int_t i=0;i<fCacheNFilled;i++){
+    Int_t slot=fCacheOrder[i];
+    Int_t sphSlot=slot%fCacheNSph;
+    Int_t multSlot=(slot/fCacheNSph)%fCacheNMult;
+    Int_t eventType=slot/(fCacheNSph*fCacheNMult);
+    CountKey(eventType,fCacheRun,multSlot,sphSlot>0,sphSlot-1,fCacheCounts[slot]);
+    fCacheCounts[slot]=0;
+  }
+  fCacheNFilled=0;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::ResetCountCache(){
+  // Flushes the cache and drops its layout, which depends on the
+  // multiplicity and spherocity settings
+
+  FlushCounts();
+  fCacheCounts.Set(0);
+  fCacheOrder.Set(0);
+  fCacheRun=-1;
+}
@@ -33,6 +33,7 @@
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TH1D.h>
+#include <TArrayI.h>
 #include <AliESDEvent.h>
 #include <AliESDtrack.h>
 #include <AliAODTrack.h>
@@ -49,20 +50,26 @@ class AliNormalizationCounter : public TNamed
 {
  public:
 
+  /// event types counted in the "Event" rubric
+  enum EEventType {kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm,
+                   kNoPrimaryV, kZvtxGT10, kNoV0ACandle03, kNoV0APrimaryV, kCandidFilter, kCandidAnalysis,
+                   kNCandidFilter, kNCandidAnalysis, kNEventTypes};
+
   AliNormalizationCounter();
   AliNormalizationCounter(const char *name);
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){FlushCounts(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
-  void SetStudyMultiplicity(Bool_t flag, Float_t etaRange){ fMultiplicity=flag; fMultiplicityEtaRange=etaRange; }
-  void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){fSpherocity=flag;
+  void SetStudyMultiplicity(Bool_t flag, Float_t etaRange){ ResetCountCache(); fMultiplicity=flag; fMultiplicityEtaRange=etaRange; }
+  void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){ResetCountCache(); fSpherocity=flag;
     fSpherocitySteps=nsteps;}
   void StoreEvent(AliVEvent*,AliRDHFCuts *,Bool_t mc=kFALSE, Int_t multiplicity=-9999, Double_t spherocity=-99.);
   void StoreCandidates(AliVEvent*, Int_t nCand=0,Bool_t flagFilter=kTRUE);
+  void FlushCounts();
   TH1D* DrawAgainstRuns(TString candle="candid(filter)",Bool_t drawHist=kTRUE);
   TH1D* DrawRatio(TString candle1="candid(filter)",TString candle2="triggered");
   void PrintRubrics();
@@ -83,7 +90,12 @@ class AliNormalizationCounter : public TNamed
   AliNormalizationCounter(const AliNormalizationCounter &source);
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
-  void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  void FillCounters(Int_t eventType, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  void CountEvent(Int_t eventType, Int_t runNumber, Int_t multiplicity, Bool_t useSpherocity, Int_t sphToInteger, Int_t nCounts=1);
+  void CountKey(Int_t eventType, Int_t runNumber, Int_t multiplicity, Bool_t useSpherocity, Int_t sphToInteger, Int_t nCounts);
+  void ResetCountCache();
+
+  static const char* fgkEventTypeNames[kNEventTypes]; /// keywords of the "Event" rubric
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -96,6 +108,12 @@ class AliNormalizationCounter : public TNamed
   TH2F *fHistTrackAnaEvMult;/// hist to store no of analysis candidates vs no of tracks in the event
   TH2F *fHistTrackFilterSpdMult; /// hist to store no of filter candidates vs  SPD multiplicity
   TH2F *fHistTrackAnaSpdMult;/// hist to store no of analysis candidates vs SPD multiplicity 
+  TArrayI fCacheCounts; //! counts not yet in fCounters for run fCacheRun, indexed by (event type, multiplicity, spherocity)
+  TArrayI fCacheOrder;  //! cache slots in the order they were first counted
+  Int_t fCacheNFilled;  //! number of used entries in fCacheOrder
+  Int_t fCacheRun;      //! run number of the cached counts
+  Int_t fCacheNMult;    //! number of multiplicity slots in the cache
+  Int_t fCacheNSph;     //! number of spherocity slots in the cache (slot 0 = no spherocity in key)
 
   /// \cond CLASSIMP    
   ClassDef(AliNormalizationCounter,7);
@@ -942,6 +942,13 @@ void AliAnalysisTaskSELambdacUp::UserExec(Option_t */*option*/)
 
 
 
+//________________________________________________________________________
+void AliAnalysisTaskSELambdacUp::FinishTaskOutput()
+{
+  // Move the counts cached by the normalization counter to the counter collection before the output is written
+  if(fCounter) fCounter->FlushCounts();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSELambdacUp::Terminate(Option_t */*option*/)
 {
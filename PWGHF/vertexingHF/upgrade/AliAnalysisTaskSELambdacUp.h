@@ -73,6 +73,7 @@ class AliAnalysisTaskSELambdacUp : public AliAnalysisTaskSE
   virtual void LocalInit() {Init();}
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
     
  private:
 
@@ -15,13 +15,15 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliRhoJetList.h"
 
 ClassImp(AliAnalysisTaskRho)
 
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho() : 
   AliAnalysisTaskRhoBase("AliAnalysisTaskRho"),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -29,7 +31,8 @@ AliAnalysisTaskRho::AliAnalysisTaskRho() :
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho(const char *name, Bool_t histo) :
   AliAnalysisTaskRhoBase(name, histo),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -47,65 +50,34 @@ Bool_t AliAnalysisTaskRho::Run()
   if (!fJets)
     return kFALSE;
 
-  const Int_t Njets   = fJets->GetEntries();
-
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
+  // the jet read is shared with the other rho tasks on this collection,
+  // the acceptance depends on the cuts of this task
+  AliRhoJetList *jetList = AliRhoJetList::GetList(InputEvent(), fJets, Entry());
+  fJetBuffer.Clear();
+  for (Int_t ij = 0; ij < jetList->GetNJets(); ++ij) {
+    AliEmcalJet *jet = jetList->GetJet(ij);
+    fJetBuffer.AddJet(jet, jetList->GetIndex(ij), AcceptJet(jet));
   }
-
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fJetBuffer.ExcludeLeadingJets(fNExclLeadJets);
 
   // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+  for (Int_t i = 0; i < fJetBuffer.GetNJets(); ++i) {
 
     // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
-      continue;
-
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
+    if (fJetBuffer.IsExcluded(i))
       continue;
-    } 
 
-    if (!AcceptJet(jet))
+    if (!fJetBuffer.IsAccepted(i))
       continue;
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    AliEmcalJet *jet = fJetBuffer.GetJet(i);
+    fJetBuffer.AddValue(jet->Pt() / jet->Area());
   }
 
 
-  if (NjetAcc > 0) {
+  if (fJetBuffer.GetNValues() > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = fJetBuffer.Median();
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
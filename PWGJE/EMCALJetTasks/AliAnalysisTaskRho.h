@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoBase.h"
+#include "AliRhoJetBuffer.h"
 
 class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
 
@@ -18,6 +19,7 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
   Bool_t           Run();
 
   UInt_t           fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
+  AliRhoJetBuffer  fJetBuffer;                     //! jets and densities of the current event
 
   AliAnalysisTaskRho(const AliAnalysisTaskRho&);             // not implemented
   AliAnalysisTaskRho& operator=(const AliAnalysisTaskRho&);  // not implemented
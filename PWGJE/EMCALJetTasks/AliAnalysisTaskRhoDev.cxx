@@ -25,6 +25,7 @@
 #include "AliEmcalJet.h"
 #include "AliRhoParameter.h"
 #include "AliJetContainer.h"
+#include "AliRhoJetBuffer.h"
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisTaskRhoDev);
@@ -39,7 +40,8 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev() :
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
   fOccupancyFactor(0),
-  fHistOccCorrvsCent(nullptr)
+  fHistOccCorrvsCent(nullptr),
+  fRhoValues()
 {
 }
 
@@ -55,7 +57,8 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev(const char *name, Bool_t histo) :
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
   fOccupancyFactor(0),
-  fHistOccCorrvsCent(nullptr)
+  fHistOccCorrvsCent(nullptr),
+  fRhoValues()
 {
 }
 
@@ -104,8 +107,7 @@ void AliAnalysisTaskRhoDev::CalculateRho()
 
   auto maxJets = GetLeadingJets();
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fRhoValues.clear();
   Double_t TotaljetArea = 0; // Total area of background jets (including ghost jets)
   Double_t TotaljetAreaPhys = 0; // Total area of physical background jets (excluding ghost jets)
   // Ghost jet is a jet made only of ghost particles
@@ -141,8 +143,7 @@ void AliAnalysisTaskRhoDev::CalculateRho()
 
     if (overlapsWithSignal) continue;
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    fRhoValues.push_back(jet->Pt() / jet->Area());
   }
 
   // Occupancy correction for sparse event described in https://arxiv.org/abs/1207.2392
@@ -153,9 +154,9 @@ void AliAnalysisTaskRhoDev::CalculateRho()
     fOccupancyFactor = 0;
   }
 
-  if (NjetAcc > 0) {
+  if (!fRhoValues.empty()) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = AliRhoJetBuffer::Median(fRhoValues);
 
     if (fRhoSparse) rho = rho * fOccupancyFactor;
 
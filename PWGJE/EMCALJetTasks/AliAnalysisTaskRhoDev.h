@@ -16,6 +16,7 @@
 #define ALIANALYSISTASKRHODEV_H
 
 #include <utility>
+#include <vector>
 
 #include "AliAnalysisTaskRhoBaseDev.h"
 
@@ -72,6 +73,7 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
 
   Double_t         fOccupancyFactor;               //!<!occupancy correction factor for sparse events
   TH2F            *fHistOccCorrvsCent;             //!<!occupancy correction vs. centrality
+  std::vector<Double_t> fRhoValues;               //!<!pt densities of the background jets of the current event
 
   AliAnalysisTaskRhoDev(const AliAnalysisTaskRhoDev&);             // not implemented
   AliAnalysisTaskRhoDev& operator=(const AliAnalysisTaskRhoDev&);  // not implemented
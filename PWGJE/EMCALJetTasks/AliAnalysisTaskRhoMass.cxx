@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliRhoJetList.h"
 
 ClassImp(AliAnalysisTaskRhoMass)
 
@@ -24,7 +25,8 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -35,7 +37,8 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass(const char *name, Bool_t histo) :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -69,57 +72,29 @@ Bool_t AliAnalysisTaskRhoMass::Run()
   if (!fJets)
     return kFALSE;
 
-  const Int_t Njets   = fJets->GetEntries();
-
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
+  // the jet read is shared with the other rho tasks on this collection,
+  // the acceptance depends on the cuts of this task
+  AliRhoJetList *jetList = AliRhoJetList::GetList(InputEvent(), fJets, Entry());
+  fJetBuffer.Clear();
+  for (Int_t ij = 0; ij < jetList->GetNJets(); ++ij) {
+    AliEmcalJet *jet = jetList->GetJet(ij);
+    fJetBuffer.AddJet(jet, jetList->GetIndex(ij), AcceptJet(jet));
   }
+  fJetBuffer.ExcludeLeadingJets(fNExclLeadJets);
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
-  Int_t NjetAcc = 0;
+  Double_t sumE = 0.;
+  Double_t sumM = 0.;
 
   // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+  for (Int_t i = 0; i < fJetBuffer.GetNJets(); ++i) {
 
     // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+    if (fJetBuffer.IsExcluded(i))
       continue;
 
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
+    AliEmcalJet *jet = fJetBuffer.GetJet(i);
 
-    if (!AcceptJet(jet))
+    if (!fJetBuffer.IsAccepted(i))
       continue;
 
     // Double_t sumM = GetSumMConstituents(jet);
@@ -127,22 +102,23 @@ Bool_t AliAnalysisTaskRhoMass::Run()
     if(jet->Area()>0.) {// && (jet->M()*jet->M() + jet->Pt()*jet->Pt())>0.) {
       //rhomvec[NjetAcc] = (TMath::Sqrt(sumM*sumM + sumPt*sumPt) - sumPt ) / jet->Area();
       // rhomvec[NjetAcc] = (TMath::Sqrt(jet->M()*jet->M() + jet->Pt()*jet->Pt()) - jet->Pt() ) / jet->Area();
-      rhomvec[NjetAcc] = GetMd(jet) / jet->Area();
-      fHistMdAreavsCent->Fill(fCent,rhomvec[NjetAcc]);
-      Evec[NjetAcc] = jet->E();
-      Mvec[NjetAcc] = jet->M();
-      ++NjetAcc;
+      Double_t rhomJet = GetMd(jet) / jet->Area();
+      fHistMdAreavsCent->Fill(fCent,rhomJet);
+      fJetBuffer.AddValue(rhomJet);
+      sumE += jet->E();
+      sumM += jet->M();
     }
   }
 
+  Int_t NjetAcc = fJetBuffer.GetNValues();
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = fJetBuffer.Median();
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
-    Double_t meanM = TMath::Mean(NjetAcc, Mvec);
-    Double_t meanE = TMath::Mean(NjetAcc, Evec);
+    Double_t meanM = sumM / NjetAcc;
+    Double_t meanE = sumE / NjetAcc;
     Double_t gamma = 0.;
     if(meanM>0.) gamma = meanE/meanM;
     fHistGammaVsNtrack->Fill(Ntracks,gamma);
@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoMassBase.h"
+#include "AliRhoJetBuffer.h"
 
 class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
 
@@ -36,6 +37,7 @@ class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
   Bool_t           fPionMassClusters;              // assume pion mass for clusters
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
+  AliRhoJetBuffer  fJetBuffer;                     //! jets and densities of the current event
 
   AliAnalysisTaskRhoMass(const AliAnalysisTaskRhoMass&);             // not implemented
   AliAnalysisTaskRhoMass& operator=(const AliAnalysisTaskRhoMass&);  // not implemented
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliRhoJetList.h"
 #include "AliJetContainer.h"
 
 ClassImp(AliAnalysisTaskRhoMassSparse)
@@ -25,7 +26,8 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -36,7 +38,8 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse(const char *name, Boo
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -100,62 +103,35 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
   if (!fJets)
     return kFALSE;
 
-  const Int_t Njets   = fJets->GetEntries();
   
   AliJetContainer *sigjets = static_cast<AliJetContainer*>(fJetCollArray.At(1));
   
   Int_t NjetsSig = 0;
   if (sigjets) NjetsSig = sigjets->GetNJets();
 
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
+  // the jet read is shared with the other rho tasks on this collection,
+  // the acceptance depends on the cuts of this task
+  AliRhoJetList *jetList = AliRhoJetList::GetList(InputEvent(), fJets, Entry());
+  fJetBuffer.Clear();
+  for (Int_t ij = 0; ij < jetList->GetNJets(); ++ij) {
+    AliEmcalJet *jet = jetList->GetJet(ij);
+    fJetBuffer.AddJet(jet, jetList->GetIndex(ij), AcceptJet(jet));
   }
+  fJetBuffer.ExcludeLeadingJets(fNExclLeadJets);
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
-  Int_t NjetAcc = 0;
+  Double_t sumE = 0.;
+  Double_t sumM = 0.;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
 
   // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+  for (Int_t i = 0; i < fJetBuffer.GetNJets(); ++i) {
 
     // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+    if (fJetBuffer.IsExcluded(i))
       continue;
 
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
+    AliEmcalJet *jet = fJetBuffer.GetJet(i);
 
     TotaljetArea+=jet->Area();
 
@@ -163,7 +139,7 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
       TotaljetAreaPhys+=jet->Area();
     }
 
-    if (!AcceptJet(jet))
+    if (!fJetBuffer.IsAccepted(i))
       continue;
 
       // Search for overlap with signal jets
@@ -194,11 +170,11 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     if(jet->Area()>0.) {// && (jet->M()*jet->M() + jet->Pt()*jet->Pt())>0.) {
        //rhomvec[NjetAcc] = (TMath::Sqrt(sumM*sumM + sumPt*sumPt) - sumPt ) / jet->Area();
       // rhomvec[NjetAcc] = (TMath::Sqrt(jet->M()*jet->M() + jet->Pt()*jet->Pt()) - jet->Pt() ) / jet->Area();
-      rhomvec[NjetAcc] = GetMd(jet) / jet->Area();
-      fHistMdAreavsCent->Fill(fCent,rhomvec[NjetAcc]);
-      Evec[NjetAcc] = jet->E();
-      Mvec[NjetAcc] = jet->M();
-      ++NjetAcc;
+      Double_t rhomJet = GetMd(jet) / jet->Area();
+      fHistMdAreavsCent->Fill(fCent,rhomJet);
+      fJetBuffer.AddValue(rhomJet);
+      sumE += jet->E();
+      sumM += jet->M();
     }
   }
 
@@ -209,9 +185,10 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
 
+  Int_t NjetAcc = fJetBuffer.GetNValues();
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = fJetBuffer.Median();
     if(fRhoCMS){
       rhom = rhom * OccCorr;
     }
@@ -219,8 +196,8 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
-    Double_t meanM = TMath::Mean(NjetAcc, Mvec);
-    Double_t meanE = TMath::Mean(NjetAcc, Evec);
+    Double_t meanM = sumM / NjetAcc;
+    Double_t meanE = sumE / NjetAcc;
     Double_t gamma = 0.;
     if(meanM>0.) gamma = meanE/meanM;
     fHistGammaVsNtrack->Fill(Ntracks,gamma);
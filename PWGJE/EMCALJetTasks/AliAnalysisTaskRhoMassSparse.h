@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoMassBase.h"
+#include "AliRhoJetBuffer.h"
 
 class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
 
@@ -42,6 +43,7 @@ class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
+  AliRhoJetBuffer  fJetBuffer;                     //! jets and densities of the current event
 
   AliAnalysisTaskRhoMassSparse(const AliAnalysisTaskRhoMassSparse&);             // not implemented
   AliAnalysisTaskRhoMassSparse& operator=(const AliAnalysisTaskRhoMassSparse&);  // not implemented
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliRhoJetList.h"
 #include "AliJetContainer.h"
 
 ClassImp(AliAnalysisTaskRhoSparse)
@@ -24,7 +25,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse() :
   AliAnalysisTaskRhoBase("AliAnalysisTaskRhoSparse"),
   fNExclLeadJets(0),
   fRhoCMS(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -34,7 +36,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse(const char *name, Bool_t hist
   AliAnalysisTaskRhoBase(name, histo),
   fNExclLeadJets(0),
   fRhoCMS(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fJetBuffer()
 {
   // Constructor.
 }
@@ -89,60 +92,33 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (!fJets)
     return kFALSE;
 
-  const Int_t Njets = fJets->GetEntries();
 
   AliJetContainer *sigjets = static_cast<AliJetContainer*>(fJetCollArray.At(1));
 
   Int_t NjetsSig = 0;
   if (sigjets) NjetsSig = sigjets->GetNJets();
 
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
+  // the jet read is shared with the other rho tasks on this collection,
+  // the acceptance depends on the cuts of this task
+  AliRhoJetList *jetList = AliRhoJetList::GetList(InputEvent(), fJets, Entry());
+  fJetBuffer.Clear();
+  for (Int_t ij = 0; ij < jetList->GetNJets(); ++ij) {
+    AliEmcalJet *jet = jetList->GetJet(ij);
+    fJetBuffer.AddJet(jet, jetList->GetIndex(ij), AcceptJet(jet));
   }
+  fJetBuffer.ExcludeLeadingJets(fNExclLeadJets);
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
 
   // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+  for (Int_t i = 0; i < fJetBuffer.GetNJets(); ++i) {
 
     // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+    if (fJetBuffer.IsExcluded(i))
       continue;
 
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
+    AliEmcalJet *jet = fJetBuffer.GetJet(i);
 
     TotaljetArea+=jet->Area();
     
@@ -150,7 +126,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       TotaljetAreaPhys+=jet->Area();
     }
 
-    if (!AcceptJet(jet))
+    if (!fJetBuffer.IsAccepted(i))
       continue;
 
    // Search for overlap with signal jets
@@ -176,8 +152,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       continue;
 
     if(jet->Pt()>0.1){
-      rhovec[NjetAcc] = jet->Pt() / jet->Area();
-      ++NjetAcc;
+      fJetBuffer.AddValue(jet->Pt() / jet->Area());
     }
   }
 
@@ -187,9 +162,9 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
-  if (NjetAcc > 0) {
+  if (fJetBuffer.GetNValues() > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = fJetBuffer.Median();
 
     if(fRhoCMS){
       rho = rho * OccCorr;
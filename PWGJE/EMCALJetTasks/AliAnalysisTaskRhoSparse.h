@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoBase.h"
+#include "AliRhoJetBuffer.h"
 
 class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
 
@@ -25,6 +26,7 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   Bool_t           fRhoCMS;                        // flag to run CMS method
 
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
+  AliRhoJetBuffer  fJetBuffer;                     //! jets and densities of the current event
 
   AliAnalysisTaskRhoSparse(const AliAnalysisTaskRhoSparse&);             // not implemented
   AliAnalysisTaskRhoSparse& operator=(const AliAnalysisTaskRhoSparse&);  // not implemented
@@ -19,7 +19,10 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
+#include <TVector2.h>
 #include <TH2F.h>
 #include <THnSparse.h>
 
@@ -47,6 +50,17 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
   fEmbeddingQA(),
+  fJets1(),
+  fJets2(),
+  fJetPairs(),
+  fJetCandidates(),
+  fJetGridCells(),
+  fJetGridEtaMin(0),
+  fJetGridEtaCell(0),
+  fJetGridNEta(0),
+  fJetGridNPhi(0),
+  fJetsOfTrack(),
+  fSharingJets1(),
   fHistoType(0),
   fDeltaPtAxis(0),
   fDeltaEtaDeltaPhiAxis(0),
@@ -136,6 +150,17 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
   fEmbeddingQA(),
+  fJets1(),
+  fJets2(),
+  fJetPairs(),
+  fJetCandidates(),
+  fJetGridCells(),
+  fJetGridEtaMin(0),
+  fJetGridEtaCell(0),
+  fJetGridNEta(0),
+  fJetGridNPhi(0),
+  fJetsOfTrack(),
+  fSharingJets1(),
   fHistoType(0),
   fDeltaPtAxis(0),
   fDeltaEtaDeltaPhiAxis(0),
@@ -1417,6 +1442,10 @@ Bool_t AliJetResponseMaker::DoJetMatching()
 void AliJetResponseMaker::DoJetLoop()
 {
   // Do the jet loop.
+  // The matching only uses the closest and second closest jets of each jet.
+  // For geometrical and MC label matching, only the pairs that can give them
+  // are compared (see AddGridPairs and AddMCLabelPairs), in the order of the
+  // full loop, so that the closest and second closest jets are unchanged.
 
   AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
   AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
@@ -1426,20 +1455,285 @@ void AliJetResponseMaker::DoJetLoop()
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
+  fJets2.clear();
   jets2->ResetCurrentID();
-  while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
+  while ((jet2 = jets2->GetNextJet())) {
+    jet2->ResetMatching();
+    fJets2.push_back(jet2);
+  }
+
+  // The full loop resets each jet 1 just before comparing it, which matters
+  // if both containers hold the same jets
+  Double_t maxDist = TMath::Min(fMatchingPar1, fMatchingPar2);
+  Bool_t usePairs = kFALSE;
+  if (jets1->GetArray() != jets2->GetArray()) {
+    if (fMatching == kGeometrical) usePairs = (maxDist > 0);
+    else if (fMatching == kMCLabel) usePairs = BuildTrackToJetMap();
+  }
+
+  if (!usePairs) {
+    jets1->ResetCurrentID();
+    while ((jet1 = jets1->GetNextJet())) {
+      jet1->ResetMatching();
 
+      if (jet1->MCPt() < fMinJetMCPt) continue;
+
+      for (UInt_t i = 0; i < fJets2.size(); i++) {
+        SetMatchingLevel(jet1, fJets2[i], fMatching);
+      } // jet2 loop
+    } // jet1 loop
+    return;
+  }
+
+  fJets1.clear();
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
     jet1->ResetMatching();
 
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
-    jets2->ResetCurrentID();
-    while ((jet2 = jets2->GetNextJet())) {
-      SetMatchingLevel(jet1, jet2, fMatching);
-    } // jet2 loop
-  } // jet1 loop
+    fJets1.push_back(jet1);
+  }
+
+  fJetPairs.clear();
+  if (fMatching == kGeometrical) AddGridPairs(maxDist);
+  else AddMCLabelPairs();
+
+  // Pairs are encoded as (position in fJets1) * n2 + (position in fJets2),
+  // so sorting them gives the order of the full loop
+  std::sort(fJetPairs.begin(), fJetPairs.end());
+  fJetPairs.erase(std::unique(fJetPairs.begin(), fJetPairs.end()), fJetPairs.end());
+
+  Long64_t n2 = fJets2.size();
+  for (UInt_t i = 0; i < fJetPairs.size(); i++) {
+    SetMatchingLevel(fJets1[fJetPairs[i] / n2], fJets2[fJetPairs[i] % n2], fMatching);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::AddGridPairs(Double_t cellSize)
+{
+  // Add the pairs made of each jet and the jets of the other collection
+  // that can be its closest or second closest jet. These are found on an
+  // (eta,phi) grid of the other collection.
+
+  Long64_t n2 = fJets2.size();
+
+  BuildJetGrid(fJets2, cellSize);
+  for (UInt_t i1 = 0; i1 < fJets1.size(); i1++) {
+    FindClosestJetCandidates(fJets1[i1], fJets2, kTRUE);
+    for (UInt_t i = 0; i < fJetCandidates.size(); i++) fJetPairs.push_back(i1 * n2 + fJetCandidates[i]);
+  }
+
+  BuildJetGrid(fJets1, cellSize);
+  for (UInt_t i2 = 0; i2 < fJets2.size(); i2++) {
+    FindClosestJetCandidates(fJets2[i2], fJets1, kFALSE);
+    for (UInt_t i = 0; i < fJetCandidates.size(); i++) fJetPairs.push_back(fJetCandidates[i] * n2 + i2);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::BuildJetGrid(const std::vector<AliEmcalJet*> &jets, Double_t cellSize)
+{
+  // Sort the jets in (eta,phi) cells at least cellSize wide.
+
+  // Small margin so that rounding at the cell edges cannot skip a cell
+  Double_t cellMin = cellSize * (1 + 1e-6);
+
+  Double_t etaMin = 0;
+  Double_t etaMax = 0;
+  for (UInt_t i = 0; i < jets.size(); i++) {
+    Double_t eta = jets[i]->Eta();
+    if (i == 0 || eta < etaMin) etaMin = eta;
+    if (i == 0 || eta > etaMax) etaMax = eta;
+  }
+
+  // Cells may be wider than cellMin; the number of cells is bounded for tiny sizes
+  fJetGridEtaMin = etaMin;
+  fJetGridNEta = TMath::Max(1, TMath::Min(100, TMath::FloorNint((etaMax - etaMin) / cellMin)));
+  fJetGridEtaCell = TMath::Max((etaMax - etaMin) / fJetGridNEta, cellMin);
+  fJetGridNPhi = TMath::Max(1, TMath::Min(100, TMath::FloorNint(TMath::TwoPi() / cellMin)));
+
+  fJetGridCells.resize(fJetGridNEta * fJetGridNPhi);
+  for (UInt_t i = 0; i < fJetGridCells.size(); i++) fJetGridCells[i].clear();
+
+  for (UInt_t i = 0; i < jets.size(); i++) {
+    Int_t iEta = TMath::Min(fJetGridNEta - 1, TMath::FloorNint((jets[i]->Eta() - fJetGridEtaMin) / fJetGridEtaCell));
+    Int_t iPhi = TMath::FloorNint(TVector2::Phi_0_2pi(jets[i]->Phi()) / TMath::TwoPi() * fJetGridNPhi) % fJetGridNPhi;
+    fJetGridCells[iEta * fJetGridNPhi + iPhi].push_back(i);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::FindClosestJetCandidates(AliEmcalJet *jet, const std::vector<AliEmcalJet*> &jets, Bool_t isJet1)
+{
+  // Collect in fJetCandidates the positions in jets (sorted in the grid) of
+  // the jets found by a search in growing square rings of cells around jet.
+  // The search stops when the second closest jet found is closer than any
+  // jet in the cells not visited yet, so the closest and second closest jets,
+  // ties included, are among the candidates.
+
+  fJetCandidates.clear();
+
+  Double_t closest = TMath::Infinity();
+  Double_t second = TMath::Infinity();
+
+  Int_t iEta = TMath::FloorNint((jet->Eta() - fJetGridEtaMin) / fJetGridEtaCell);
+  Int_t iPhi = TMath::FloorNint(TVector2::Phi_0_2pi(jet->Phi()) / TMath::TwoPi() * fJetGridNPhi) % fJetGridNPhi;
+
+  // phi offsets in (-nPhi/2, nPhi/2]: each cell once, at its circular distance
+  Int_t phiLow = -((fJetGridNPhi - 1) / 2);
+  Int_t phiHigh = fJetGridNPhi / 2;
+  Int_t kMax = TMath::Max(TMath::Max(iEta, fJetGridNEta - 1 - iEta), phiHigh);
+  Double_t cellMin = TMath::Min(fJetGridEtaCell, TMath::TwoPi() / fJetGridNPhi);
+
+  for (Int_t k = 0; k <= kMax; k++) {
+    for (Int_t dEta = -k; dEta <= k; dEta++) {
+      Int_t jEta = iEta + dEta;
+      if (jEta < 0 || jEta >= fJetGridNEta) continue;
+      // full rows at the top and bottom of the ring, only the two ends otherwise
+      Int_t step = (dEta == -k || dEta == k) ? 1 : 2 * k;
+      for (Int_t dPhi = -k; dPhi <= k; dPhi += step) {
+        if (dPhi < phiLow || dPhi > phiHigh) continue;
+        Int_t jPhi = (iPhi + dPhi + fJetGridNPhi) % fJetGridNPhi;
+        const std::vector<Int_t> &cell = fJetGridCells[jEta * fJetGridNPhi + jPhi];
+        for (UInt_t i = 0; i < cell.size(); i++) {
+          // same call as GetGeometricalMatchingLevel
+          Double_t d = isJet1 ? jet->DeltaR(jets[cell[i]]) : jets[cell[i]]->DeltaR(jet);
+          if (d < closest) {
+            second = closest;
+            closest = d;
+          }
+          else if (d < second) {
+            second = d;
+          }
+          fJetCandidates.push_back(cell[i]);
+        }
+      }
+    }
+
+    // The jets in the cells not visited yet are more than k cells away
+    if (second < k * cellMin * (1 - 1e-6)) break;
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliJetResponseMaker::BuildTrackToJetMap()
+{
+  // Map each track of the jets 2 particle container to the jets 2 containing it.
+  // Returns kFALSE if there is no particle container to look the MC labels up.
+
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+  AliParticleContainer *tracks2 = jets2->GetParticleContainer();
+  if (!tracks2 || !tracks2->GetArray()) return kFALSE;
+
+  for (UInt_t i = 0; i < fJetsOfTrack.size(); i++) fJetsOfTrack[i].clear();
+
+  for (UInt_t i = 0; i < fJets2.size(); i++) {
+    for (Int_t iTrack2 = 0; iTrack2 < fJets2[i]->GetNumberOfTracks(); iTrack2++) {
+      Int_t index2 = fJets2[i]->TrackAt(iTrack2);
+      if (index2 < 0) continue;
+      if (index2 >= (Int_t)fJetsOfTrack.size()) fJetsOfTrack.resize(index2 + 1);
+      std::vector<Int_t> &jets = fJetsOfTrack[index2];
+      if (jets.empty() || jets.back() != (Int_t)i) jets.push_back(i);
+    }
+  }
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::AddMCLabelPairs()
+{
+  // Add the pairs of jets sharing MC particles, and for each jet the first
+  // two pairs in loop order with jets of the other collection sharing none.
+  // A pair sharing no particle has d1 = 1 (or -1 for every jet 2) and
+  // d2 = 1 (or -1 for every jet 1), so among these pairs only the first two
+  // can give the closest and second closest jets.
+
+  Long64_t n1 = fJets1.size();
+  Long64_t n2 = fJets2.size();
+
+  fSharingJets1.resize(n2);
+  for (UInt_t i = 0; i < fSharingJets1.size(); i++) fSharingJets1[i].clear();
+
+  for (Long64_t i1 = 0; i1 < n1; i1++) {
+    GetMCLabelCandidates(fJets1[i1]);
+    for (UInt_t i = 0; i < fJetCandidates.size(); i++) {
+      fJetPairs.push_back(i1 * n2 + fJetCandidates[i]);
+      fSharingJets1[fJetCandidates[i]].push_back(i1);
+    }
+    AddFirstNonSharingPairs(fJetCandidates, n2, i1, kTRUE);
+  }
+
+  for (Long64_t i2 = 0; i2 < n2; i2++) {
+    AddFirstNonSharingPairs(fSharingJets1[i2], n1, i2, kFALSE);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::AddFirstNonSharingPairs(const std::vector<Int_t> &sharing, Long64_t n, Long64_t jet, Bool_t isJet1)
+{
+  // Add the pairs of jet with the first two of the n jets of the other
+  // collection that are not in sharing (sorted positions).
+
+  Long64_t n2 = fJets2.size();
+  Int_t nFound = 0;
+  UInt_t is = 0;
+  for (Long64_t i = 0; i < n && nFound < 2; i++) {
+    while (is < sharing.size() && sharing[is] < i) is++;
+    if (is < sharing.size() && sharing[is] == i) continue;
+    fJetPairs.push_back(isJet1 ? jet * n2 + i : i * n2 + jet);
+    nFound++;
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetMCLabelCandidates(AliEmcalJet *jet1)
+{
+  // Collect, in increasing order, the jets 2 sharing at least one MC particle
+  // with jet1, looking the labels up as in GetMCLabelMatchingLevel.
+
+  fJetCandidates.clear();
+
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+  AliParticleContainer *tracks2 = jets2->GetParticleContainer();
+
+  std::vector<Int_t> indexes;
+
+  for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+    AliVParticle *track = jet1->Track(iTrack);
+    if (!track) continue;
+    Int_t MClabel = TMath::Abs(track->GetLabel()) - fMCLabelShift;
+    if (MClabel <= 0) continue;
+    indexes.push_back(tracks2->GetIndexFromLabel(MClabel));
+  }
+
+  for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+    AliVCluster *clus = jet1->Cluster(iClus);
+    if (!clus) continue;
+    if (fUseCellsToMatch && fCaloCells) {
+      for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+        Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(clus->GetCellAbsId(iCell))) - fMCLabelShift;
+        if (MClabel <= 0) continue;
+        indexes.push_back(tracks2->GetIndexFromLabel(MClabel));
+      }
+    }
+    else {
+      Int_t MClabel = TMath::Abs(clus->GetLabel()) - fMCLabelShift;
+      if (MClabel <= 0) continue;
+      indexes.push_back(tracks2->GetIndexFromLabel(MClabel));
+    }
+  }
+
+  for (UInt_t i = 0; i < indexes.size(); i++) {
+    Int_t index = indexes[i];
+    if (index < 0 || index >= (Int_t)fJetsOfTrack.size()) continue;
+    fJetCandidates.insert(fJetCandidates.end(), fJetsOfTrack[index].begin(), fJetsOfTrack[index].end());
+  }
+
+  std::sort(fJetCandidates.begin(), fJetCandidates.end());
+  fJetCandidates.erase(std::unique(fJetCandidates.begin(), fJetCandidates.end()), fJetCandidates.end());
 }
 
 //________________________________________________________________________
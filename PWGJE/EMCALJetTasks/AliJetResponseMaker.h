@@ -19,6 +19,8 @@
 // Author : Salvatore Aiola, Yale University, salvatore.aiola@cern.ch
 //-----------------------------------------------------------------------
 
+#include <vector>
+
 class TClonesArray;
 class TH2;
 class THnSparse;
@@ -63,6 +65,13 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
  protected:
   void                        ExecOnce();
   void                        DoJetLoop();
+  void                        AddGridPairs(Double_t cellSize);
+  void                        BuildJetGrid(const std::vector<AliEmcalJet*> &jets, Double_t cellSize);
+  void                        FindClosestJetCandidates(AliEmcalJet *jet, const std::vector<AliEmcalJet*> &jets, Bool_t isJet1);
+  Bool_t                      BuildTrackToJetMap();
+  void                        AddMCLabelPairs();
+  void                        AddFirstNonSharingPairs(const std::vector<Int_t> &sharing, Long64_t n, Long64_t jet, Bool_t isJet1);
+  void                        GetMCLabelCandidates(AliEmcalJet *jet1);
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
@@ -82,6 +91,17 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
   AliEmcalEmbeddingQA         fEmbeddingQA;                            //!<! Embedding QA hists (will only be added if embedding)
+  std::vector<AliEmcalJet*>   fJets1;                                  //!<! jets 1 above the minimum MC pt, in loop order
+  std::vector<AliEmcalJet*>   fJets2;                                  //!<! jets 2 in loop order
+  std::vector<Long64_t>       fJetPairs;                               //!<! pairs to compare, as (position in fJets1) * (number of jets 2) + (position in fJets2)
+  std::vector<Int_t>          fJetCandidates;                          //!<! positions of the candidate jets of the current jet in the other collection
+  std::vector<std::vector<Int_t> > fJetGridCells;                      //!<! positions of the jets in each (eta,phi) cell of the jet grid
+  Double_t                    fJetGridEtaMin;                          //!<! lower eta edge of the jet grid
+  Double_t                    fJetGridEtaCell;                         //!<! eta size of the jet grid cells
+  Int_t                       fJetGridNEta;                            //!<! number of eta cells of the jet grid
+  Int_t                       fJetGridNPhi;                            //!<! number of phi cells of the jet grid
+  std::vector<std::vector<Int_t> > fJetsOfTrack;                       //!<! positions in fJets2 of the jets 2 containing each track of the particle container 2
+  std::vector<std::vector<Int_t> > fSharingJets1;                     //!<! positions in fJets1 of the jets 1 sharing MC particles with each jet 2
   Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
   Int_t                       fDeltaEtaDeltaPhiAxis;                   // add delta eta and delta phi axes in THnSparse (default=0)
@@ -0,0 +1,120 @@
+/**************************************************************************
+ * Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "AliRhoJetBuffer.h"
+
+#include <algorithm>
+
+#include "AliEmcalJet.h"
+
+/**
+ * Default constructor.
+ */
+AliRhoJetBuffer::AliRhoJetBuffer() :
+  fJets(),
+  fIndexes(),
+  fAccepted(),
+  fValues()
+{
+  fLeadingIds[0] = -1;
+  fLeadingIds[1] = -1;
+}
+
+/**
+ * Empty the buffer for a new event, keeping the allocated memory.
+ */
+void AliRhoJetBuffer::Clear()
+{
+  fJets.clear();
+  fIndexes.clear();
+  fAccepted.clear();
+  fValues.clear();
+  fLeadingIds[0] = -1;
+  fLeadingIds[1] = -1;
+}
+
+/**
+ * Add a jet of the collection. Jets must be added in container order.
+ * @param jet Jet
+ * @param index Index of the jet in the container
+ * @param accepted Whether the jet passed the jet selection
+ */
+void AliRhoJetBuffer::AddJet(AliEmcalJet *jet, Int_t index, Bool_t accepted)
+{
+  fJets.push_back(jet);
+  fIndexes.push_back(index);
+  fAccepted.push_back(accepted);
+}
+
+/**
+ * Find the (up to two) leading accepted jets to be excluded from the
+ * median. Jets are compared in container order and a later jet only
+ * takes the place of an earlier one with strictly larger pt; the
+ * running maxima are kept in single precision as in the original
+ * implementation of the rho tasks.
+ * @param n Number of leading jets to exclude
+ */
+void AliRhoJetBuffer::ExcludeLeadingJets(UInt_t n)
+{
+  fLeadingIds[0] = -1;
+  fLeadingIds[1] = -1;
+  if (n == 0) return;
+
+  Float_t maxJetPts[] = {0, 0};
+  for (UInt_t i = 0; i < fJets.size(); i++) {
+    if (!fAccepted[i]) continue;
+    Double_t pt = fJets[i]->Pt();
+    if (pt > maxJetPts[0]) {
+      maxJetPts[1] = maxJetPts[0];
+      fLeadingIds[1] = fLeadingIds[0];
+      maxJetPts[0] = pt;
+      fLeadingIds[0] = fIndexes[i];
+    } else if (pt > maxJetPts[1]) {
+      maxJetPts[1] = pt;
+      fLeadingIds[1] = fIndexes[i];
+    }
+  }
+  if (n < 2) fLeadingIds[1] = -1;
+}
+
+/**
+ * Median of the collected densities. The order of the buffer is
+ * not preserved.
+ * @return Median, or 0 if there are no values
+ */
+Double_t AliRhoJetBuffer::Median()
+{
+  return Median(fValues);
+}
+
+/**
+ * Median of the values, found by selection. For an even number of
+ * values it is the average of the two central ones, as in TMath::Median.
+ * @param values Values; their order is not preserved
+ * @return Median, or 0 if there are no values
+ */
+Double_t AliRhoJetBuffer::Median(std::vector<Double_t> &values)
+{
+  Int_t n = values.size();
+  if (n <= 0) return 0;
+
+  std::vector<Double_t>::iterator mid = values.begin() + n / 2;
+  std::nth_element(values.begin(), mid, values.end());
+  if (n % 2 == 1) return *mid;
+
+  Double_t high = *mid;
+  Double_t low = *std::max_element(values.begin(), mid);
+  return 0.5 * (low + high);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file AliRhoJetBuffer.h
+ * @brief Declaration of class AliRhoJetBuffer
+ *
+ * In this header file the class AliRhoJetBuffer is declared.
+ */
+
+/* Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#ifndef ALIRHOJETBUFFER_H
+#define ALIRHOJETBUFFER_H
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliEmcalJet;
+
+/** \class AliRhoJetBuffer
+ * \brief Per-event jet buffer shared by the rho tasks
+ *
+ * Holds the jets of a background jet collection read in a single
+ * pass, together with their acceptance, and finds the leading jets
+ * to be excluded from that same pass. The densities entering the
+ * median are collected in a reusable buffer and the median is found
+ * by selection, with the same result as TMath::Median.
+ *
+ * The jets themselves come from the AliRhoJetList that the rho tasks
+ * share through the event. The acceptance, the excluded leading jets
+ * and the densities stay in this per-task buffer, since each task
+ * selects jets with the cuts of its own jet container.
+ */
+class AliRhoJetBuffer {
+
+ public:
+  AliRhoJetBuffer();
+
+  void                Clear();
+  void                AddJet(AliEmcalJet *jet, Int_t index, Bool_t accepted);
+  void                ExcludeLeadingJets(UInt_t n);
+
+  Int_t               GetNJets()                   const { return fJets.size()        ; }
+  AliEmcalJet        *GetJet(Int_t i)              const { return fJets[i]            ; }
+  Int_t               GetIndex(Int_t i)            const { return fIndexes[i]         ; }
+  Bool_t              IsAccepted(Int_t i)          const { return fAccepted[i]        ; }
+  Bool_t              IsExcluded(Int_t i)          const { return fIndexes[i] == fLeadingIds[0] || fIndexes[i] == fLeadingIds[1]; }
+
+  void                AddValue(Double_t v)               { fValues.push_back(v)       ; }
+  Int_t               GetNValues()                 const { return fValues.size()      ; }
+  Double_t            GetValue(Int_t i)            const { return fValues[i]          ; }
+  Double_t            Median();
+
+  static Double_t     Median(std::vector<Double_t> &values);
+
+ protected:
+  std::vector<AliEmcalJet*> fJets;                 ///< jets of the collection, in container order
+  std::vector<Int_t>        fIndexes;              ///< index of each jet in the container
+  std::vector<Bool_t>       fAccepted;             ///< whether each jet passed the jet selection
+  std::vector<Double_t>     fValues;               ///< densities entering the median
+  Int_t                     fLeadingIds[2];        ///< container indexes of the excluded leading jets (-1 if none)
+};
+#endif
@@ -0,0 +1,103 @@
+/**************************************************************************
+ * Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "AliRhoJetList.h"
+
+#include <TClonesArray.h>
+#include <TString.h>
+
+#include "AliEmcalJet.h"
+#include "AliVEvent.h"
+
+/// \cond CLASSIMP
+ClassImp(AliRhoJetList);
+/// \endcond
+
+/**
+ * Default constructor.
+ */
+AliRhoJetList::AliRhoJetList() :
+  TNamed(),
+  fJets(),
+  fIndexes(),
+  fArray(0),
+  fNEntries(-1),
+  fEntry(-1)
+{
+}
+
+/**
+ * Named constructor.
+ * @param name Name under which the list is attached to the event
+ */
+AliRhoJetList::AliRhoJetList(const char *name) :
+  TNamed(name, name),
+  fJets(),
+  fIndexes(),
+  fArray(0),
+  fNEntries(-1),
+  fEntry(-1)
+{
+}
+
+/**
+ * Returns the list of the jet collection for the current event,
+ * attaching it to the event on first use and reading the collection
+ * again if it was filled for another event.
+ * @param event Input event the list is attached to
+ * @param jets Jet collection
+ * @param entry Entry number of the current event
+ * @return Jet list, or 0 if no event or collection is given
+ */
+AliRhoJetList *AliRhoJetList::GetList(AliVEvent *event, TClonesArray *jets, Long64_t entry)
+{
+  if (!event || !jets) return 0;
+
+  TString name(TString::Format("%s_RhoJetList", jets->GetName()));
+  AliRhoJetList *list = dynamic_cast<AliRhoJetList*>(event->FindListObject(name));
+  if (!list) {
+    list = new AliRhoJetList(name);
+    event->AddObject(list);
+  }
+
+  if (list->fEntry != entry || list->fArray != jets || list->fNEntries != jets->GetEntriesFast()) {
+    list->Fill(jets, entry);
+  }
+
+  return list;
+}
+
+/**
+ * Reads the jet collection, skipping the empty slots.
+ * @param jets Jet collection
+ * @param entry Entry number of the current event
+ */
+void AliRhoJetList::Fill(TClonesArray *jets, Long64_t entry)
+{
+  fJets.clear();
+  fIndexes.clear();
+
+  const Int_t n = jets->GetEntriesFast();
+  for (Int_t i = 0; i < n; ++i) {
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(jets->At(i));
+    if (!jet) continue;
+    fJets.push_back(jet);
+    fIndexes.push_back(i);
+  }
+
+  fArray = jets;
+  fNEntries = n;
+  fEntry = entry;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file AliRhoJetList.h
+ * @brief Declaration of class AliRhoJetList
+ *
+ * In this header file the class AliRhoJetList is declared.
+ */
+
+/* Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#ifndef ALIRHOJETLIST_H
+#define ALIRHOJETLIST_H
+
+#include <vector>
+
+#include <TNamed.h>
+
+class TClonesArray;
+class AliVEvent;
+class AliEmcalJet;
+
+/** \class AliRhoJetList
+ * \brief Jets of one collection, read once per event for all rho tasks
+ *
+ * The list is attached to the input event under the name
+ * "<collection>_RhoJetList". The first rho task running on a
+ * collection in an event reads the jet array, the following ones
+ * find the list with FindListObject and reuse it. The list is read
+ * again when the entry number, the array or its number of entries
+ * differ from the ones it was filled with.
+ */
+class AliRhoJetList : public TNamed {
+
+ public:
+  AliRhoJetList();
+  AliRhoJetList(const char *name);
+
+  static AliRhoJetList *GetList(AliVEvent *event, TClonesArray *jets, Long64_t entry);
+
+  Int_t               GetNJets()                   const { return fJets.size()        ; }
+  AliEmcalJet        *GetJet(Int_t i)              const { return fJets[i]            ; }
+  Int_t               GetIndex(Int_t i)            const { return fIndexes[i]         ; }
+
+ protected:
+  void                Fill(TClonesArray *jets, Long64_t entry);
+
+  std::vector<AliEmcalJet*> fJets;                 //!<! non-null jets of the collection, in container order
+  std::vector<Int_t>        fIndexes;              //!<! index of each jet in the container
+  TClonesArray             *fArray;                //!<! array the list was filled from
+  Int_t                     fNEntries;             //!<! number of entries of the array when filled
+  Long64_t                  fEntry;                //!<! entry the list was filled for
+
+ private:
+  AliRhoJetList(const AliRhoJetList&);             // not implemented
+  AliRhoJetList& operator=(const AliRhoJetList&);  // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliRhoJetList, 1); // Jets of one collection shared by the rho tasks
+  /// \endcond
+};
+#endif
@@ -18,6 +18,8 @@
 #pragma link C++ class AliAnalysisTaskRhoBaseDev+;
 #pragma link C++ class AliAnalysisTaskRhoDev+;
 #pragma link C++ class AliAnalysisTaskRhoTransDev+;
+#pragma link C++ class AliRhoJetBuffer+;
+#pragma link C++ class AliRhoJetList+;
 #pragma link C++ class AliAnalysisTaskDeltaPt+;
 #pragma link C++ class AliAnalysisTaskScale+;
 #pragma link C++ class AliEmcalJetByJetCorrection+;
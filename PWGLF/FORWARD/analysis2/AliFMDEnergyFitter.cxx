@@ -1056,6 +1056,10 @@ AliFMDEnergyFitter::RingHistos::FitSlices(TList*           dir,
     best->Clear();
     best->SetOwner(false);
   }
+  // 1-particle fit parameters of the previous eta bin, used as initial
+  // guesses for the next one (unset if that bin was not fitted)
+  Double_t seed[AliLandauGaus::kN];
+  seed[AliLandauGaus::kDelta] = 0;
   for (Int_t i = 0; i < nDists; i++) { 
     // Ignore empty histograms altoghether 
     Int_t b    = i+1;
@@ -1064,6 +1068,7 @@ AliFMDEnergyFitter::RingHistos::FitSlices(TList*           dir,
     if (!dist) { 
       // If we got the null pointer, return 0
       nEmpty++;
+      seed[AliLandauGaus::kDelta] = 0;
       continue;
     }
     // Then releasing the histogram from the it's directory
@@ -1085,7 +1090,8 @@ AliFMDEnergyFitter::RingHistos::FitSlices(TList*           dir,
 				  minWeight,
 				  regCut,
 				  scaleToPeak,
-				  status1);
+				  status1,
+				  seed);
     if (!res) {
       switch (status1) { 
       case 1: nEmpty++; break;
@@ -1227,7 +1233,8 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
 					Double_t  minWeight,
 					Double_t  regCut,
 					Bool_t    scaleToPeak,
-					UShort_t& status) const
+					UShort_t& status,
+					Double_t* seed) const
 {
   // 
   // Fit a signal histogram.  First, the bin @f$ b_{min}@f$ with
@@ -1250,6 +1257,10 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
   //                    is loosend by a factor of 2 
   //    chi2nuCut   Cut on @f$ \chi^2/\nu@f$ - 
   //                    the reduced @f$\chi^2@f$ 
+  //    seed        In: 1-particle parameters of the neighbouring 
+  //                    distribution used as initial guesses, if 
+  //                    seed[kDelta] > 0. Out: 1-particle parameters 
+  //                    of this distribution, seed[kDelta]=0 if none 
   // 
   // Return:
   //    The best fit function 
@@ -1258,6 +1269,15 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
 	 dist->GetName());
   Double_t maxRange = 10;
 
+  // Take the seed of the neighbour, and clear it in case we return early 
+  Double_t        neighbour[AliLandauGaus::kN];
+  const Double_t* warm = 0;
+  if (seed && seed[AliLandauGaus::kDelta] > 0) {
+    for (Int_t i = 0; i < AliLandauGaus::kN; i++) neighbour[i] = seed[i];
+    warm = neighbour;
+  }
+  if (seed) seed[AliLandauGaus::kDelta] = 0;
+
 
   if (dist->GetEntries() <= 0) { 
     status = 1; // `empty'
@@ -1308,10 +1328,17 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
       dist->SetBinError(i, e * s);
     }
   }
+  // Fit a single particle, starting from the neighbour's fit if any 
+  TF1* r = f.Fit1Particle(dist, 0, warm);
+  if (seed) {
+    // Pass the parameters of a converged 1-particle fit to the next bin 
+    TFitResult* r1 = static_cast<TFitResult*>(f.GetFitResults().At(0));
+    if (r1 && r1->IsValid()) 
+      for (Int_t i = 0; i < AliLandauGaus::kN; i++) seed[i] = r1->Parameter(i);
+  }
   // If we are only asked to fit a single particle, return this fit, 
   // no matter what. 
   if (nParticles == 1) {
-    TF1* r = f.Fit1Particle(dist, 0);
     if (!r) {
       status = 3; // No-fit
       return 0;
@@ -1324,7 +1351,7 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
     return ret;
   }
 
-  // Fit from 2 upto n particles  
+  // Fit from 2 upto n particles, starting from the 1-particle fit above 
   for (Int_t i = 2; i <= nParticles; i++) f.FitNParticle(dist, i, 0);
 
   // Now, we need to select the best fit 
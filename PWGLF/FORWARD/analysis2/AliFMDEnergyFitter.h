@@ -580,6 +580,14 @@ public:
      * @param scaleToPeak If true, scale distribution to peak value
      * @param status      On return, contain the status code (0: OK, 1:
      *                    empty, 2: low statistics, 3: fit failed)
+     * @param seed        If not null, and the element
+     *                    AliLandauGaus::kDelta is positive, the
+     *                    parameters of the 1-particle fit to the
+     *                    neighbouring distribution, used as initial
+     *                    guesses (see AliLandauGausFitter::Fit1Particle).
+     *                    On return, the parameters of the 1-particle
+     *                    fit to @a dist, or AliLandauGaus::kDelta set
+     *                    to 0 if that fit did not converge.
      * 
      * @return The best fit function 
      */
@@ -593,7 +601,8 @@ public:
 				Double_t  minWeight,
 				Double_t  regCut,
 				Bool_t    scaleToPeak,
-				UShort_t& status) const;
+				UShort_t& status,
+				Double_t* seed=0) const;
     /** 
      * Find the best fit 
      * 
@@ -162,6 +162,16 @@ public:
    * Number of steps to do in the Landau, Gaussiam convolution 
    */
   static Int_t NSteps() { return 100; }
+  /** 
+   * Gaussian weights of the sampling points of the Landau, Gaussian
+   * convolution in F.  The sampling points are at fixed multiples of
+   * @f$\sigma'@f$ from @f$ x@f$, so the weights do not depend on the
+   * parameters and are tabulated once.  Entry @f$ i@f$ is the weight
+   * of both the @f$ i^{\mbox{th}}@f$ point from below and from above.
+   *
+   * @return Array of NSteps()/2+1 weights 
+   */
+  static const Double_t* GausWeights();
   /* @} */
 
   //__________________________________________________________________
@@ -523,6 +533,24 @@ AliLandauGaus::Fl(Double_t x, Double_t delta, Double_t xi)
   return TMath::Landau(x, deltaP, xi, true);
 }
 //____________________________________________________________________
+inline const Double_t*
+AliLandauGaus::GausWeights()
+{
+  static Double_t weights[101]; // NSteps()/2+1 entries used
+  static Bool_t   filled = false;
+  if (!filled) { 
+    const Int_t    nSteps = NSteps();
+    const Double_t nSigma = NSigma();
+    // (x - x_i) / sigma' of the i'th sampling point in F
+    for (Int_t i = 0; i <= nSteps/2; i++) { 
+      const Double_t u = nSigma - (i - .5) * 2 * nSigma / nSteps;
+      weights[i]       = TMath::Exp(-.5 * u * u);
+    }
+    filled = true;
+  }
+  return weights;
+}
+//____________________________________________________________________
 inline Double_t 
 AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
 		 Double_t sigma, Double_t sigmaN)
@@ -532,18 +560,20 @@ AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
   const Int_t    nSteps = NSteps();
   const Double_t nSigma = NSigma();
   const Double_t deltaP = delta; // - sigma * sigmaShift; // + sigma * mpshift;
+  const Double_t mpv    = deltaP - xi * MPShift(); // As in Fl
   const Double_t sigma2 = sigmaN*sigmaN + sigma*sigma;
   const Double_t sigma1 = sigmaN == 0 ? sigma : TMath::Sqrt(sigma2);
   const Double_t xlow   = x - nSigma * sigma1;
   const Double_t xhigh  = x + nSigma * sigma1;
   const Double_t step   = (xhigh - xlow) / nSteps;
+  const Double_t* w     = GausWeights();
   Double_t       sum    = 0;
   
   for (Int_t i = 0; i <= nSteps/2; i++) { 
     const Double_t x1 = xlow  + (i - .5) * step;
     const Double_t x2 = xhigh - (i - .5) * step;
-    sum += Fl(x1, deltaP, xi) * TMath::Gaus(x, x1, sigma1);
-    sum += Fl(x2, deltaP, xi) * TMath::Gaus(x, x2, sigma1);
+    sum += (TMath::Landau(x1, mpv, xi, true) + 
+	    TMath::Landau(x2, mpv, xi, true)) * w[i];
   }
   return step * sum * InvSq2Pi() / sigma1;
 }
@@ -103,10 +103,16 @@ public:
    * @param sigman If larger than zero, the initial guess of the
    *               detector induced noise. If zero or less, then this 
    *               parameter is ignored in the fit (fixed at 0)
+   * @param seed   If not null, parameters (indexed by kDelta, kXi,
+   *               and kSigma) of a 1-particle fit to a neighbouring
+   *               distribution, used as initial guesses.  If the fit
+   *               from these does not converge, or they are outside
+   *               the parameter limits, the initial guesses are taken
+   *               from the peak of @a dist as without a seed.
    * 
    * @return The function fitted to the data 
    */
-  TF1* Fit1Particle(TH1* dist, Double_t sigman=-1);
+  TF1* Fit1Particle(TH1* dist, Double_t sigman=-1, const Double_t* seed=0);
   /** 
    * Fit a N-particle signal to the passed energy loss distribution 
    *
@@ -210,7 +216,8 @@ protected:
 
 //____________________________________________________________________
 inline TF1*
-AliLandauGausFitter::Fit1Particle(TH1* dist, Double_t sigman)
+AliLandauGausFitter::Fit1Particle(TH1* dist, Double_t sigman, 
+				  const Double_t* seed)
 {
   // Clear the cache 
   Clear();
@@ -246,23 +253,45 @@ AliLandauGausFitter::Fit1Particle(TH1* dist, Double_t sigman)
   // Restore the range 
   dist->GetXaxis()->SetRange(1, maxBin);
   
-  // Define the function to fit 
-  TF1* f = AliLandauGaus::MakeF1(intg,peakE,peakE/10,peakE/5,sigman,minE,maxE);
-  SetParLimits(f, kDelta, peakE,   minE, fMaxRange);
-  SetParLimits(f, kXi,    peakE,   0,    2*rmsE); // 0.1
-  SetParLimits(f, kSigma, peakE/5, 1e-5, rmsE); // 0.1
-  if (sigman <= 0)  
-    f->FixParameter(kSigmaN, 0);
-  else 
-    SetParLimits(f, kSigmaN, peakE, 0, rmsE);
-  
+  // Only use the seed if it is within the parameter limits 
+  Bool_t useSeed = (seed && 
+		    seed[kDelta] >= minE && seed[kDelta] <= fMaxRange &&
+		    seed[kXi]    >  0    && seed[kXi]    <= 2*rmsE &&
+		    seed[kSigma] >= 1e-5 && seed[kSigma] <= rmsE);
 
   TString opts(Form("%s%s", GetFitOptions(), fDebug ? "" : "Q"));
-  // Do the fit, getting the result object 
-  if (fDebug) 
-    ::Info(/*"Fit1Particle"*/"", "Fitting in the range %f,%f", minE, maxE);
-  TFitResultPtr r = dist->Fit(f, opts, "", minE, maxE);
-  if (!r.Get()) { 
+  TF1*          f = 0;
+  TFitResultPtr r;
+  for (Int_t attempt = (useSeed ? 0 : 1); attempt < 2; attempt++) { 
+    // First attempt from the seed, then from the peak 
+    Bool_t   fromSeed = (attempt == 0);
+    Double_t delta    = fromSeed ? seed[kDelta] : peakE;
+    Double_t xi       = fromSeed ? seed[kXi]    : peakE/10;
+    Double_t sigma    = fromSeed ? seed[kSigma] : peakE/5;
+
+    // Define the function to fit 
+    f = AliLandauGaus::MakeF1(intg,delta,xi,sigma,sigman,minE,maxE);
+    SetParLimits(f, kDelta, delta,   minE, fMaxRange);
+    SetParLimits(f, kXi,    peakE,   0,    2*rmsE); // 0.1
+    SetParLimits(f, kSigma, sigma,   1e-5, rmsE); // 0.1
+    if (sigman <= 0)  
+      f->FixParameter(kSigmaN, 0);
+    else 
+      SetParLimits(f, kSigmaN, peakE, 0, rmsE);
+  
+    // Do the fit, getting the result object 
+    if (fDebug) 
+      ::Info(/*"Fit1Particle"*/"", "Fitting in the range %f,%f%s", minE, maxE,
+	     fromSeed ? " from seed" : "");
+    r = dist->Fit(f, opts, "", minE, maxE);
+    if (r.Get() && (!fromSeed || r->IsValid())) break;
+
+    if (fromSeed && fDebug) 
+      ::Info(/*"Fit1Particle"*/"", "Fit from seed failed, using the peak");
+    delete f;
+    f = 0;
+  }
+  if (!f) { 
     ::Warning("Fit1Particle", 
 	      "No fit returned when processing %s in the range [%f,%f] "
 	      "options %s", dist->GetName(), minE, maxE, opts.Data());
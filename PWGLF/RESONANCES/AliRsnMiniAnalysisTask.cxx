@@ -14,6 +14,7 @@
 //
 
 #include <Riostream.h>
+#include <algorithm>
 
 #include <TH1.h>
 #include <TList.h>
@@ -88,6 +89,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fTriggerAna(0x0),
    fESDtrackCuts(0x0),
    fMiniEvent(0x0),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle(),
+   fPairGroups(),
+   fMixGroups(),
+   fMixReflectGroups(),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
    fCheckDecay(kTRUE),
@@ -146,6 +153,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC) :
    fTriggerAna(0x0),
    fESDtrackCuts(0x0),
    fMiniEvent(0x0),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle(),
+   fPairGroups(),
+   fMixGroups(),
+   fMixReflectGroups(),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
    fCheckDecay(kTRUE),
@@ -209,6 +222,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fTriggerAna(copy.fTriggerAna),
    fESDtrackCuts(copy.fESDtrackCuts),
    fMiniEvent(0x0),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle(),
+   fPairGroups(),
+   fMixGroups(),
+   fMixReflectGroups(),
    fBigOutput(copy.fBigOutput),
    fMixPrintRefresh(copy.fMixPrintRefresh),
    fCheckDecay(copy.fCheckDecay),
@@ -474,6 +493,9 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
       fMiniEvent->ID() = id;
       fEvBuffer->Fill();
+      fMixVz.push_back(fMiniEvent->Vz());
+      fMixMult.push_back(fMiniEvent->Mult());
+      fMixAngle.push_back(fMiniEvent->Angle());
    }
 
    // post data for computed stuff
@@ -496,10 +518,14 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
+   // outputs with the same daughter pairing share the pair loop of each event
+   InitPairGroups();
+   Int_t igroup, nGroups;
+
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
       if (nEvents>1e5) printNum=nEvents/100;
@@ -523,6 +549,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       for (idef = 0; idef < nDefs; idef++) {
          def = (AliRsnMiniOutput *)fHistograms[idef];
          if (!def) continue;
+         // pair-based outputs are filled below, with one pair loop for each pairing
+         if (def->IsPairBased()) continue;
          compType = def->GetComputation();
          // execute computation in the appropriate way
          switch (compType) {
@@ -531,22 +559,6 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
                ifill = 1;
                def->FillEvent(fMiniEvent, &fValues);
                break;
-            case AliRsnMiniOutput::kTruePair:
-               //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPair:
-               //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated1:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated2:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
             default:
                // other kinds are processed elsewhere
                ifill = 0;
@@ -555,6 +567,13 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          // message
          AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
       }
+      // pair-based outputs (true pairs, pairs, rotated background)
+      nGroups = (Int_t)fPairGroups.size();
+      for (igroup = 0; igroup < nGroups; igroup++) {
+         def = fPairGroups[igroup][0];
+         ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues, kTRUE, &fPairGroups[igroup][0], (Int_t)fPairGroups[igroup].size());
+         AliDebugClass(1, Form("Event %6d: def = '%15s' (%d outputs) -- fills = %5d", ievt, def->GetName(), (Int_t)fPairGroups[igroup].size(), ifill));
+      }
    }
 
    // if no mixing is required, stop here and post the output
@@ -564,14 +583,24 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
+   // index the events by their mixing bins (vz, mult, angle), using the values kept at fill time:
+   // the candidates of an event are searched only in its own bin (binned mixing)
+   // or in the neighbouring bins (continuous mixing), without reading the buffer
+   Int_t ivz, imult, iangle, icand, ncand, binVz, binMult, binAngle;
+   std::vector< std::vector<Int_t> > bins(nEvents, std::vector<Int_t>(4));
    for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
+      bins[ievt][0] = MixingBin(fMixVz[ievt], fMaxDiffVz);
+      bins[ievt][1] = MixingBin(fMixMult[ievt], fMaxDiffMult);
+      bins[ievt][2] = MixingBin(fMixAngle[ievt], fMaxDiffAngle);
+      bins[ievt][3] = ievt;
    }
+   std::sort(bins.begin(), bins.end());
+   Int_t nNeighbours = fContinuousMix ? 1 : 0;
 
+   // initialize mixing counter
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > smatched(nEvents);
+   std::vector<Int_t> candidates, key(4);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
@@ -583,64 +612,79 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
+      // collect the matching events in the neighbouring bins
+      candidates.clear();
+      binVz    = MixingBin(fMixVz[ievt], fMaxDiffVz);
+      binMult  = MixingBin(fMixMult[ievt], fMaxDiffMult);
+      binAngle = MixingBin(fMixAngle[ievt], fMaxDiffAngle);
+      for (ivz = -nNeighbours; ivz <= nNeighbours; ivz++) {
+         for (imult = -nNeighbours; imult <= nNeighbours; imult++) {
+            for (iangle = -nNeighbours; iangle <= nNeighbours; iangle++) {
+               key[0] = binVz + ivz;
+               key[1] = binMult + imult;
+               key[2] = binAngle + iangle;
+               key[3] = -1;
+               std::vector< std::vector<Int_t> >::const_iterator it = std::lower_bound(bins.begin(), bins.end(), key);
+               for (; it != bins.end() && (*it)[0] == key[0] && (*it)[1] == key[1] && (*it)[2] == key[2]; ++it) {
+                  imix = (*it)[3];
+                  if (imix == ievt) continue;
+                  // skip if events are not matched
+                  if (!EventsMatch(fMixVz[ievt], fMixMult[ievt], fMixAngle[ievt], fMixVz[imix], fMixMult[imix], fMixAngle[imix])) continue;
+                  // order the candidates as the events following the main one in the buffer
+                  candidates.push_back((imix - ievt + nEvents) % nEvents);
+               }
+            }
+         }
+      }
+      std::sort(candidates.begin(), candidates.end());
+      ncand = (Int_t)candidates.size();
+      for (icand = 0; icand < ncand; icand++) {
+         imix = (ievt + candidates[icand]) % nEvents;
          // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
+         if (std::find(smatched[imix].begin(), smatched[imix].end(), ievt) != smatched[imix].end()) continue;
          // check that the found good events has not enough matches already
          if (nmatched[imix] >= fNMix) continue;
          // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
+         smatched[ievt].push_back(imix);
          nmatched[ievt]++;
          nmatched[imix]++;
          if (nmatched[ievt] >= fNMix) break;
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
+   Int_t ipartner, npartners;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
+      npartners = (Int_t)smatched[ievt].size();
+      if (!npartners) continue;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      for (ipartner = 0; ipartner < npartners; ipartner++) {
+         imix = smatched[ievt][ipartner];
          fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
-               AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
-            }
+         nGroups = (Int_t)fMixGroups.size();
+         for (igroup = 0; igroup < nGroups; igroup++) {
+            def = fMixGroups[igroup][0];
+            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE, &fMixGroups[igroup][0], (Int_t)fMixGroups[igroup].size());
+         }
+         nGroups = (Int_t)fMixReflectGroups.size();
+         for (igroup = 0; igroup < nGroups; igroup++) {
+            AliDebugClass(2, "Reflecting non symmetric pair");
+            def = fMixReflectGroups[igroup][0];
+            ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE, &fMixReflectGroups[igroup][0], (Int_t)fMixReflectGroups[igroup].size());
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1492,6 +1536,91 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Same as above, on the mixing variables of the two events,
+// used to search the matches without reading the mini-event buffer.
+//
+
+   if (fContinuousMix) {
+      if (TMath::Abs(vz1    - vz2   ) > fMaxDiffVz   ) return kFALSE;
+      if (TMath::Abs(mult1  - mult2 ) > fMaxDiffMult ) return kFALSE;
+      if (TMath::Abs(angle1 - angle2) > fMaxDiffAngle) return kFALSE;
+      return kTRUE;
+   } else {
+      if ((Int_t)(vz1    / fMaxDiffVz   ) != (Int_t)(vz2    / fMaxDiffVz   )) return kFALSE;
+      if ((Int_t)(mult1  / fMaxDiffMult ) != (Int_t)(mult2  / fMaxDiffMult )) return kFALSE;
+      if ((Int_t)(angle1 / fMaxDiffAngle) != (Int_t)(angle2 / fMaxDiffAngle)) return kFALSE;
+      return kTRUE;
+   }
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::MixingBin(Float_t value, Double_t maxDiff) const
+{
+//
+// Bin of a mixing variable used to index the events in FinishTaskOutput.
+// For binned mixing this is the bin used in EventsMatch, so that matching events share it.
+// For continuous mixing the bins have the size of the allowed difference,
+// so that matching events are at most in the neighbouring bin.
+// A non positive difference puts all the events in the same bin.
+//
+
+   if (maxDiff <= 0.0) return 0;
+   if (fContinuousMix) return (Int_t)TMath::Floor(value / maxDiff);
+   return (Int_t)(value / maxDiff);
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::InitPairGroups()
+{
+//
+// Group the pair-based outputs with the same daughter pairing
+// (charges, cut IDs, species, mother mass): the outputs of a group
+// (e.g. like-sign, rotated, true pairs) are filled from a single loop
+// on the pairs of each couple of events, see AliRsnMiniOutput::FillPair.
+// Same-event outputs, mixing outputs and the non symmetric mixing outputs,
+// which are filled also with the events swapped, are grouped separately.
+//
+
+   Int_t idef, nDefs = fHistograms.GetEntries();
+   AliRsnMiniOutput *def = 0x0;
+
+   fPairGroups.clear();
+   fMixGroups.clear();
+   fMixReflectGroups.clear();
+   for (idef = 0; idef < nDefs; idef++) {
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      if (!def->IsPairBased()) continue;
+      if (def->IsTrackPairMix()) {
+         AddToPairGroup(fMixGroups, def);
+         if (!def->IsSymmetric()) AddToPairGroup(fMixReflectGroups, def);
+      } else {
+         AddToPairGroup(fPairGroups, def);
+      }
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::AddToPairGroup(std::vector< std::vector<AliRsnMiniOutput *> > &groups, AliRsnMiniOutput *def)
+{
+//
+// Add the output to the group with its pairing, or start a new one.
+//
+
+   UInt_t igroup;
+   for (igroup = 0; igroup < groups.size(); igroup++) {
+      if (!groups[igroup][0]->HasSamePairing(def)) continue;
+      groups[igroup].push_back(def);
+      AliDebugClass(1, Form("Def '%s': pair loop shared with '%s'", def->GetName(), groups[igroup][0]->GetName()));
+      return;
+   }
+   groups.push_back(std::vector<AliRsnMiniOutput *>(1, def));
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -12,6 +12,8 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -101,6 +103,10 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   Int_t    MixingBin(Float_t value, Double_t maxDiff) const;
+   void     InitPairGroups();
+   void     AddToPairGroup(std::vector< std::vector<AliRsnMiniOutput *> > &groups, AliRsnMiniOutput *def);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -142,6 +148,12 @@ private:
    AliTriggerAnalysis  *fTriggerAna;      //! trigger analysis
    AliESDtrackCuts     *fESDtrackCuts;    //! quality cut for ESD tracks
    AliRsnMiniEvent     *fMiniEvent;       //! mini-event cursor
+   std::vector<Float_t> fMixVz;           //! mixing --> Vz of each buffered mini-event
+   std::vector<Float_t> fMixMult;         //! mixing --> multiplicity of each buffered mini-event
+   std::vector<Float_t> fMixAngle;        //! mixing --> reaction plane angle of each buffered mini-event
+   std::vector< std::vector<AliRsnMiniOutput *> > fPairGroups;        //! same-event pair outputs, grouped by daughter pairing
+   std::vector< std::vector<AliRsnMiniOutput *> > fMixGroups;         //! mixing outputs, grouped by daughter pairing
+   std::vector< std::vector<AliRsnMiniOutput *> > fMixReflectGroups;  //! non symmetric mixing outputs, grouped by daughter pairing
    Bool_t               fBigOutput;       // flag if open file for output list
    Int_t                fMixPrintRefresh; // how often info in mixing part is printed
    Bool_t               fCheckDecay;      // check if the mother decayed via the requested channel
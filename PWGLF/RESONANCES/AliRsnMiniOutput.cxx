@@ -481,22 +481,57 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 // which satisfy the charge and cut requirements defined here, add an entry.
 // Returns the number of successful fillings.
 // Last argument tells if the reference event for event-based values is the first or the second.
+//
+
+   AliRsnMiniOutput *out = this;
+   return FillPair(event1, event2, valueList, refFirst, &out, 1);
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::HasSamePairing(const AliRsnMiniOutput *out) const
+{
+//
+// Check if the passed output builds the same pairs as this one
+// (same daughter charges, cut IDs, species and mother mass),
+// so that the pairs can be built once for both (see FillPair).
+//
+
+   if (!out) return kFALSE;
+
+   Int_t i;
+   for (i = 0; i < 2; i++) {
+      if (fCharge[i]   != out->fCharge[i]  ) return kFALSE;
+      if (fCutID[i]    != out->fCutID[i]   ) return kFALSE;
+      if (fDaughter[i] != out->fDaughter[i]) return kFALSE;
+   }
+   return (fMotherMass == out->fMotherMass);
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst, AliRsnMiniOutput *const *outputs, Int_t nOutputs)
+{
+//
+// Loops on the passed mini-events, and for each pair of particles
+// which satisfy the charge and cut requirements defined here,
+// builds the pair once and passes it to all the outputs in the list,
+// which must have the same pairing as this one (see HasSamePairing).
+// Each of them adds an entry if the pair satisfies its own requirements.
+// Returns the number of successful fillings, summed over the outputs.
+// Last argument tells if the reference event for event-based values is the first or the second.
 //
 
    // check computation type
-   Bool_t okComp = kFALSE;
-   if (fComputation == kTrackPair)         okComp = kTRUE;
-   if (fComputation == kTrackPairMix)      okComp = kTRUE;
-   if (fComputation == kTrackPairRotated1) okComp = kTRUE;
-   if (fComputation == kTrackPairRotated2) okComp = kTRUE;
-   if (fComputation == kTruePair)          okComp = kTRUE;
-   if (!okComp) {
-      AliError(Form("[%s] This method can be called only for pair-based computations", GetName()));
-      return kFALSE;
+   Int_t iout;
+   for (iout = 0; iout < nOutputs; iout++) {
+      if (!outputs[iout]->IsPairBased()) {
+         AliError(Form("[%s] This method can be called only for pair-based computations", outputs[iout]->GetName()));
+         return kFALSE;
+      }
    }
 
    // loop variables
    Int_t i1, i2, start, nadded = 0;
+   Bool_t fillThis;
    AliRsnMiniParticle *p1, *p2;
 
    // it is necessary to know if criteria for the two daughters are the same
@@ -505,14 +540,16 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
    Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fDaughter[0] == fDaughter[1]));
    Bool_t sameEvent = (event1->ID() == event2->ID());
 
-   TString selList1  = "";
-   TString selList2  = "";
    Int_t   n1 = event1->CountParticles(fSel1, fCharge[0], fCutID[0]);
    Int_t   n2 = event2->CountParticles(fSel2, fCharge[1], fCutID[1]);
-   for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
-   for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
-   AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
-   AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   if (AliLog::GetDebugLevel("", ClassName()) >= 1) {
+      TString selList1  = "";
+      TString selList2  = "";
+      for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
+      for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
+      AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
+      AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   }
    if (!n1 || !n2) {
       AliDebugClass(1, "No pairs to mix");
       return 0;
@@ -521,9 +558,6 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
    // external loop
    for (i1 = 0; i1 < n1; i1++) {
       p1 = event1->GetParticle(fSel1[i1]);
-      //p1 = event1->GetParticle(i1);
-      //if (p1->Charge() != fCharge[0]) continue;
-      //if (!p1->HasCutBit(fCutID[0])) continue;
       // define starting point for inner loop
       // if daughter selection criteria (charge, cuts) are the same
       // and the two events coincide, internal loop must start from
@@ -534,9 +568,6 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
       // internal loop
       for (i2 = start; i2 < n2; i2++) {
          p2 = event2->GetParticle(fSel2[i2]);
-         //p2 = event2->GetParticle(i2);
-         //if (p2->Charge() != fCharge[1]) continue;
-         //if (!p2->HasCutBit(fCutID[1])) continue;
          // avoid to mix a particle with itself
          if (sameEvent && (p1->Index() == p2->Index())) {
             AliDebugClass(2, "Skipping same index");
@@ -544,26 +575,54 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
          }
          // sum momenta
          fPair.Fill(p1, p2, GetMass(0), GetMass(1), fMotherMass);
-         // do rotation if needed
-         if (fComputation == kTrackPairRotated1) fPair.InvertP(kTRUE);
-         if (fComputation == kTrackPairRotated2) fPair.InvertP(kFALSE);
-         // if required, check that this is a true pair
-         if (fComputation == kTruePair) {
-            if (fPair.Mother() < 0)  {
-               continue;
-            } else if (fPair.MotherPDG() != fMotherPDG) {
+         // the outputs modify the pair (rotation, boosts in the values),
+         // so the other ones work on a copy and this one comes last
+         fillThis = kFALSE;
+         for (iout = 0; iout < nOutputs; iout++) {
+            if (outputs[iout] == this) {
+               fillThis = kTRUE;
                continue;
             }
-            Bool_t decayMatch = kFALSE;
-            if (p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
-               decayMatch = kTRUE;
-            if (p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
-               decayMatch = kTRUE;
-            if (!decayMatch) continue;
-	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) continue;
+            outputs[iout]->fPair = fPair;
+            if (outputs[iout]->FillPairEntry(event1, event2, p1, p2, valueList, refFirst)) nadded++;
+         }
+         if (fillThis && FillPairEntry(event1, event2, p1, p2, valueList, refFirst)) nadded++;
+      } // end internal loop
+   } // end external loop
+
+   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
+   return nadded;
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::FillPairEntry(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2, TClonesArray *valueList, Bool_t refFirst)
+{
+//
+// Adds an entry for the pair of the two passed particles, already stored in 'fPair',
+// if it satisfies the requirements defined here.
+// Returns kTRUE if the histogram was filled.
+//
+
+   // do rotation if needed
+   if (fComputation == kTrackPairRotated1) fPair.InvertP(kTRUE);
+   if (fComputation == kTrackPairRotated2) fPair.InvertP(kFALSE);
+   // if required, check that this is a true pair
+   if (fComputation == kTruePair) {
+      if (fPair.Mother() < 0)  {
+         return kFALSE;
+      } else if (fPair.MotherPDG() != fMotherPDG) {
+         return kFALSE;
+      }
+      Bool_t decayMatch = kFALSE;
+      if (p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
+         decayMatch = kTRUE;
+      if (p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
+         decayMatch = kTRUE;
+      if (!decayMatch) return kFALSE;
+	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) return kFALSE;
 	    if ( fCheckP &&(TMath::Abs(fPair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(fPair.PmotherX())+1.e-13)) > 0.00001 && 	  
 		          (TMath::Abs(fPair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(fPair.PmotherY())+1.e-13)) > 0.00001 &&
-     			  (TMath::Abs(fPair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(fPair.PmotherZ())+1.e-13)) > 0.00001 ) continue;
+  			  (TMath::Abs(fPair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(fPair.PmotherZ())+1.e-13)) > 0.00001 ) return kFALSE;
 	    if ( fCheckFeedDown ){
 	    		Int_t pdgGranma = 0;
 	  		Bool_t isFromB=kFALSE;
@@ -580,32 +639,27 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 			  } 
 	  		if (pdgGranma == -99999){
 	  			AliDebug(2,"This particle does not have a quark in his genealogy\n");
-	  			continue;
+	  			return kFALSE;
 	  		}
 	  		if (pdgGranma == -9999){
 	  			AliDebug(2,"This particle come from a B decay channel but according to the settings of the task, we keep only the prompt charm particles\n");	
-	  			continue;
+	  			return kFALSE;
 	  		}	
 	 
 	  		if (pdgGranma == -999){
 	  			AliDebug(2,"This particle come from a prompt charm particles but according to the settings of the task, we want only the ones coming from B\n");  
-	  			continue;
+	  			return kFALSE;
 	  		}	
 		    }
-         }
-         // check pair against cuts
-         if (fPairCuts) {
-            if (!fPairCuts->IsSelected(&fPair)) continue;
-         }
-         // get computed values & fill histogram
-         nadded++;
-         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
-         FillHistogram();
-      } // end internal loop
-   } // end external loop
-
-   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
-   return nadded;
+   }
+   // check pair against cuts
+   if (fPairCuts) {
+      if (!fPairCuts->IsSelected(&fPair)) return kFALSE;
+   }
+   // get computed values & fill histogram
+   if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
+   FillHistogram();
+   return kTRUE;
 }
 //___________________________________________________________
 void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
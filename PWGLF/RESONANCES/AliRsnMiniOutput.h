@@ -59,6 +59,7 @@ public:
    Bool_t          IsTruePair()         const {return (fComputation == kTruePair);}
    Bool_t          IsMother()           const {return (fComputation == kMother);}
    Bool_t          IsMotherInAcc()      const {return (fComputation == kMotherInAcc);}
+   Bool_t          IsPairBased()        const {return (IsTrackPair() || IsTrackPairMix() || IsTruePair() || fComputation == kTrackPairRotated1 || fComputation == kTrackPairRotated2);}
    Bool_t          IsDefined()          const {return (IsEventOnly() || IsTrackPair() || IsTrackPairMix() || IsTruePair() || IsMother());}
    Bool_t          IsLikeSign()         const {return (fCharge[0] == fCharge[1]);}
    Bool_t          IsSameCut()          const {return (fCutID[0] == fCutID[1]);}
@@ -105,6 +106,8 @@ public:
    Bool_t          FillMotherInAcceptance(const AliRsnMiniPair *pair, AliRsnMiniEvent *event, TClonesArray *valueList);
    Bool_t          FillEvent(AliRsnMiniEvent *event, TClonesArray *valueList);
    Int_t           FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
+   Int_t           FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst, AliRsnMiniOutput *const *outputs, Int_t nOutputs);
+   Bool_t          HasSamePairing(const AliRsnMiniOutput *out) const;
 
 private:
 
@@ -112,6 +115,7 @@ private:
    void   CreateHistogramSparse(const char *name);
    void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList);
    void   FillHistogram();
+   Bool_t FillPairEntry(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2, TClonesArray *valueList, Bool_t refFirst);
 
    EOutputType      fOutputType;       //  type of output
    EComputation     fComputation;      //  type of computation
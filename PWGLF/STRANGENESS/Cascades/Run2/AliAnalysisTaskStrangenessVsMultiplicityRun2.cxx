@@ -63,6 +63,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <numeric>
+#include <algorithm>
 
 #include <Riostream.h>
 #include "TList.h"
@@ -322,7 +323,10 @@ fTreeCascVarPosIsKink(kFALSE),
 fTreeCascVarNegIsKink(kFALSE),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+//Cut tables
+fV0CutTable(),
+fCascadeCutTable()
 //------------------------------------------------
 // Tree Variables
 {
@@ -526,7 +530,10 @@ fTreeCascVarPosIsKink(kFALSE),
 fTreeCascVarNegIsKink(kFALSE),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+//Cut tables
+fV0CutTable(),
+fCascadeCutTable()
 {
 
     //Re-vertex: Will only apply for cascade candidates
@@ -1405,115 +1412,111 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
         //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurations = fListV0->GetEntries();
+        //All configurations are tested in one pass over the cut table (built at the first event)
+        if ( (Int_t)fV0CutTable.fHistogram.size() != fListV0->GetEntries() ) BuildV0CutTable();
+        Int_t lNumberOfConfigurations = fV0CutTable.fHistogram.size();
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
+
+        //Candidate properties per mass hypothesis: K0Short, Lambda, AntiLambda, none
+        Float_t lMass[4], lRap[4], lPDGMass[4], lNegdEdx[4], lPosdEdx[4], lBaryonMomentum[4];
+        for(Int_t ih=0; ih<4; ih++){
+            lMass[ih] = 0;
+            lRap[ih]  = 0;
+            lPDGMass[ih] = -1;
+            lNegdEdx[ih] = 100;
+            lPosdEdx[ih] = 100;
+            lBaryonMomentum[ih] = -0.5;
+        }
+        lMass   [AliV0Result::kK0Short] = fTreeVariableInvMassK0s;
+        lRap    [AliV0Result::kK0Short] = fTreeVariableRapK0Short;
+        lPDGMass[AliV0Result::kK0Short] = 0.497;
+        lNegdEdx[AliV0Result::kK0Short] = fTreeVariableNSigmasNegPion;
+        lPosdEdx[AliV0Result::kK0Short] = fTreeVariableNSigmasPosPion;
+
+        lMass   [AliV0Result::kLambda] = fTreeVariableInvMassLambda;
+        lRap    [AliV0Result::kLambda] = fTreeVariableRapLambda;
+        lPDGMass[AliV0Result::kLambda] = 1.115683;
+        lNegdEdx[AliV0Result::kLambda] = fTreeVariableNSigmasNegPion;
+        lPosdEdx[AliV0Result::kLambda] = fTreeVariableNSigmasPosProton;
+        lBaryonMomentum[AliV0Result::kLambda] = fTreeVariablePosInnerP;
+
+        lMass   [AliV0Result::kAntiLambda] = fTreeVariableInvMassAntiLambda;
+        lRap    [AliV0Result::kAntiLambda] = fTreeVariableRapLambda;
+        lPDGMass[AliV0Result::kAntiLambda] = 1.115683;
+        lNegdEdx[AliV0Result::kAntiLambda] = fTreeVariableNSigmasNegProton;
+        lPosdEdx[AliV0Result::kAntiLambda] = fTreeVariableNSigmasPosPion;
+        lBaryonMomentum[AliV0Result::kAntiLambda] = fTreeVariableNegInnerP;
+
+        //========================================================================
+        //Setting up: Variable V0 CosPA, once per distinct parameter set
+        const Int_t lNVarV0CosPA = fV0CutTable.fVarV0CosPAValue.size();
+        for(Int_t ipar=0; ipar<lNVarV0CosPA; ipar++){
+            const Float_t *lVarV0CosPApar = &fV0CutTable.fVarV0CosPAPars[5*ipar];
+            fV0CutTable.fVarV0CosPAValue[ipar] = TMath::Cos(
+                                                            lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
+                                                            lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
+                                                            lVarV0CosPApar[4]);
+        }
+        //========================================================================
+
+        Bool_t lITSRefitTracks = ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+                                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) );
+
+        const V0CutTable &lCut = fV0CutTable;
         for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
-            lV0Result = (AliV0Result*) fListV0->At(lcfg);
-            histoout  = lV0Result->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-            }
+            const Int_t lHypo = lCut.fMassHypothesis[lcfg];
+
+            Float_t lV0CosPACut = lCut.fV0CosPA[lcfg];
+            const Int_t lVarV0 = lCut.fVarV0CosPA[lcfg];
+            //Only use if tighter than the non-variable cut
+            if( lVarV0 >= 0 && lCut.fVarV0CosPAValue[lVarV0] > lV0CosPACut ) lV0CosPACut = lCut.fVarV0CosPAValue[lVarV0];
 
-            if (
+            //Every check is evaluated; none of them has side effects
+            fV0CutTable.fPass[lcfg] =
                 //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
+                ( lOnFlyStatus == lCut.fUseOnTheFly[lcfg] ) &
 
                 //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
+                ( lCut.fMinEtaTracks[lcfg] < fTreeVariableNegEta ) & ( fTreeVariableNegEta < lCut.fMaxEtaTracks[lcfg] ) &
+                ( lCut.fMinEtaTracks[lcfg] < fTreeVariablePosEta ) & ( fTreeVariablePosEta < lCut.fMaxEtaTracks[lcfg] ) &
+                ( lRap[lHypo] > lCut.fMinRapidity[lcfg] ) &
+                ( lRap[lHypo] < lCut.fMaxRapidity[lcfg] ) &
+
                 //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
+                ( fTreeVariableV0Radius > lCut.fV0Radius[lcfg] ) &
+                ( fTreeVariableDcaNegToPrimVertex > lCut.fDCANegToPV[lcfg] ) &
+                ( fTreeVariableDcaPosToPrimVertex > lCut.fDCAPosToPV[lcfg] ) &
+                ( fTreeVariableDcaV0Daughters < lCut.fDCAV0Daughters[lcfg] ) &
+                ( fTreeVariableV0CosineOfPointingAngle > lV0CosPACut ) &
+                ( fTreeVariableDistOverTotMom*lPDGMass[lHypo] < lCut.fProperLifetime[lcfg] ) &
+                ( fTreeVariableLeastNbrCrossedRows > lCut.fLeastNumberOfCrossedRows[lcfg] ) &
+                ( fTreeVariableLeastRatioCrossedRowsOverFindable > lCut.fLeastNumberOfCrossedRowsOverFindable[lcfg] ) &
 
                 //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
+                ( lHypo == AliV0Result::kK0Short || lBaryonMomentum[lHypo] > lCut.fMinBaryonMomentum[lcfg] ) &
 
                 //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
+                ( TMath::Abs(lNegdEdx[lHypo])<lCut.fTPCdEdx[lcfg] ) &
+                ( TMath::Abs(lPosdEdx[lHypo])<lCut.fTPCdEdx[lcfg] ) &
 
                 //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
+                ( !lCut.fArmenteros[lcfg] || fTreeVariablePtArmV0>lCut.fArmenterosParameter[lcfg]*TMath::Abs(fTreeVariableAlphaV0) ) &
 
                 //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
+                ( lITSRefitTracks || !lCut.fUseITSRefitTracks[lcfg] ) &
 
                 //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster()
-                 ) &&
+                ( lCut.fMaxChi2PerCluster[lcfg]>1e+3 ||
+                 fTreeVariableMaxChi2PerCluster < lCut.fMaxChi2PerCluster[lcfg]
+                 ) &
                 //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                 )
-                )
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
-            }
+                ( lCut.fMinTrackLength[lcfg]<0 || //this is a bit paranoid...
+                 fTreeVariableMinTrackLength > lCut.fMinTrackLength[lcfg]
+                 );
+        }
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+            //This satisfies all my conditionals! Fill histogram
+            if ( fV0CutTable.fPass[lcfg] ) fV0CutTable.fHistogram[lcfg] -> Fill ( fCentrality, fTreeVariablePt, lMass[lCut.fMassHypothesis[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -2177,252 +2180,208 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
         //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+        //All configurations are tested in one pass over the cut table (built at the first event)
+        if ( (Int_t)fCascadeCutTable.fHistogram.size() != fListCascade->GetEntries() ) BuildCascadeCutTable();
+        Int_t lNumberOfConfigurationsCascade = fCascadeCutTable.fHistogram.size();
         //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
-            lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
-            histoout  = lCascadeResult->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0; 
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
-
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
-
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
-            
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
+
+        //Candidate properties per mass hypothesis: XiMinus, XiPlus, OmegaMinus, OmegaPlus, none
+        Float_t lMass[5], lV0Mass[5], lRap[5], lPDGMass[5], lNegdEdx[5], lPosdEdx[5], lBachdEdx[5];
+        for(Int_t ih=0; ih<5; ih++){
+            lMass[ih] = 0;
+            lV0Mass[ih] = 0;
+            lRap[ih]  = 0;
+            lPDGMass[ih] = -1;
+            lNegdEdx[ih] = 100;
+            lPosdEdx[ih] = 100;
+            lBachdEdx[ih] = 100;
+        }
+        lMass    [AliCascadeResult::kXiMinus] = fTreeCascVarMassAsXi;
+        lV0Mass  [AliCascadeResult::kXiMinus] = fTreeCascVarV0MassLambda;
+        lRap     [AliCascadeResult::kXiMinus] = fTreeCascVarRapXi;
+        lPDGMass [AliCascadeResult::kXiMinus] = 1.32171;
+        lNegdEdx [AliCascadeResult::kXiMinus] = fTreeCascVarNegNSigmaPion;
+        lPosdEdx [AliCascadeResult::kXiMinus] = fTreeCascVarPosNSigmaProton;
+        lBachdEdx[AliCascadeResult::kXiMinus] = fTreeCascVarBachNSigmaPion;
+
+        lMass    [AliCascadeResult::kXiPlus] = fTreeCascVarMassAsXi;
+        lV0Mass  [AliCascadeResult::kXiPlus] = fTreeCascVarV0MassAntiLambda;
+        lRap     [AliCascadeResult::kXiPlus] = fTreeCascVarRapXi;
+        lPDGMass [AliCascadeResult::kXiPlus] = 1.32171;
+        lNegdEdx [AliCascadeResult::kXiPlus] = fTreeCascVarNegNSigmaProton;
+        lPosdEdx [AliCascadeResult::kXiPlus] = fTreeCascVarPosNSigmaPion;
+        lBachdEdx[AliCascadeResult::kXiPlus] = fTreeCascVarBachNSigmaPion;
+
+        lMass    [AliCascadeResult::kOmegaMinus] = fTreeCascVarMassAsOmega;
+        lV0Mass  [AliCascadeResult::kOmegaMinus] = fTreeCascVarV0MassLambda;
+        lRap     [AliCascadeResult::kOmegaMinus] = fTreeCascVarRapOmega;
+        lPDGMass [AliCascadeResult::kOmegaMinus] = 1.67245;
+        lNegdEdx [AliCascadeResult::kOmegaMinus] = fTreeCascVarNegNSigmaPion;
+        lPosdEdx [AliCascadeResult::kOmegaMinus] = fTreeCascVarPosNSigmaProton;
+        lBachdEdx[AliCascadeResult::kOmegaMinus] = fTreeCascVarBachNSigmaKaon;
+
+        lMass    [AliCascadeResult::kOmegaPlus] = fTreeCascVarMassAsOmega;
+        lV0Mass  [AliCascadeResult::kOmegaPlus] = fTreeCascVarV0MassAntiLambda;
+        lRap     [AliCascadeResult::kOmegaPlus] = fTreeCascVarRapOmega;
+        lPDGMass [AliCascadeResult::kOmegaPlus] = 1.67245;
+        lNegdEdx [AliCascadeResult::kOmegaPlus] = fTreeCascVarNegNSigmaProton;
+        lPosdEdx [AliCascadeResult::kOmegaPlus] = fTreeCascVarPosNSigmaPion;
+        lBachdEdx[AliCascadeResult::kOmegaPlus] = fTreeCascVarBachNSigmaKaon;
+
+        //For parametric V0 Mass selection
+        Float_t lExpV0Mass =
+        fLambdaMassMean[0]+
+        fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+        fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+
+        Float_t lExpV0Sigma =
+        fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+        fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+
+        //========================================================================
+        //For 2.76TeV-like parametric V0 CosPA
+        Float_t l276TeVV0CosPA = 0.998;
+        Float_t pThr=1.5;
+        if (lV0TotMomentum<pThr) {
+            //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+            const Double_t bend=0.03; // approximate Xi bending angle
+            const Double_t qt=0.211;  // max Lambda pT in Omega decay
+            const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+            Double_t
+            cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+            l276TeVV0CosPA = cpaCut;
+        }
+        //========================================================================
+
+        //========================================================================
+        //Setting up: Variable Cascade, V0 and BB CosPA, once per distinct parameter set
+        const Int_t lNVarCascCosPA = fCascadeCutTable.fVarCascCosPAValue.size();
+        for(Int_t ipar=0; ipar<lNVarCascCosPA; ipar++){
+            const Float_t *lVarCascCosPApar = &fCascadeCutTable.fVarCascCosPAPars[5*ipar];
+            fCascadeCutTable.fVarCascCosPAValue[ipar] = TMath::Cos(
                 lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
                 lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
                 lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
+        }
+        const Int_t lNVarV0CosPA = fCascadeCutTable.fVarV0CosPAValue.size();
+        for(Int_t ipar=0; ipar<lNVarV0CosPA; ipar++){
+            const Float_t *lVarV0CosPApar = &fCascadeCutTable.fVarV0CosPAPars[5*ipar];
+            fCascadeCutTable.fVarV0CosPAValue[ipar] = TMath::Cos(
+                lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
+                lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
+                lVarV0CosPApar[4]);
+        }
+        const Int_t lNVarBBCosPA = fCascadeCutTable.fVarBBCosPAValue.size();
+        for(Int_t ipar=0; ipar<lNVarBBCosPA; ipar++){
+            const Float_t *lVarBBCosPApar = &fCascadeCutTable.fVarBBCosPAPars[5*ipar];
+            fCascadeCutTable.fVarBBCosPAValue[ipar] = TMath::Cos(
+                lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
+                lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
+                lVarBBCosPApar[4]);
+        }
+        //========================================================================
 
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                               lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
+        Bool_t lITSRefitTracks = ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+                                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+                                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit) );
+        Double_t lXiMassDifference = TMath::Abs( fTreeCascVarMassAsXi - 1.32171 );
 
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            
-            if (
+        const CascadeCutTable &lCut = fCascadeCutTable;
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+            const Int_t lHypo = lCut.fMassHypothesis[lcfg];
+
+            //Variable cuts: only use if tighter than the non-variable cut
+            Float_t lCascCosPACut = lCut.fCascCosPA[lcfg];
+            const Int_t lVarCasc = lCut.fVarCascCosPA[lcfg];
+            if( lVarCasc >= 0 && lCut.fVarCascCosPAValue[lVarCasc] > lCascCosPACut ) lCascCosPACut = lCut.fVarCascCosPAValue[lVarCasc];
+
+            Float_t lV0CosPACut = lCut.fV0CosPA[lcfg];
+            const Int_t lVarV0 = lCut.fVarV0CosPA[lcfg];
+            if( lVarV0 >= 0 && lCut.fVarV0CosPAValue[lVarV0] > lV0CosPACut ) lV0CosPACut = lCut.fVarV0CosPAValue[lVarV0];
+
+            //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+            Float_t lBBCosPACut = lCut.fBachBaryonCosPA[lcfg];
+            const Int_t lVarBB = lCut.fVarBBCosPA[lcfg];
+            if( lVarBB >= 0 && lCut.fVarBBCosPAValue[lVarBB] > lBBCosPACut ) lBBCosPACut = lCut.fVarBBCosPAValue[lVarBB];
+
+            //Every check is evaluated; none of them has side effects
+            fCascadeCutTable.fPass[lcfg] =
                 //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
+                ( fTreeCascVarCharge == lCut.fCharge[lcfg] ) &
+
                 //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
+                ( lCut.fMinEtaTracks[lcfg] < fTreeCascVarPosEta ) & ( fTreeCascVarPosEta < lCut.fMaxEtaTracks[lcfg] ) &
+                ( lCut.fMinEtaTracks[lcfg] < fTreeCascVarNegEta ) & ( fTreeCascVarNegEta < lCut.fMaxEtaTracks[lcfg] ) &
+                ( lCut.fMinEtaTracks[lcfg] < fTreeCascVarBachEta ) & ( fTreeCascVarBachEta < lCut.fMaxEtaTracks[lcfg] ) &
+                ( lRap[lHypo] > lCut.fMinRapidity[lcfg] ) &
+                ( lRap[lHypo] < lCut.fMaxRapidity[lcfg] ) &
+
                 //Check 3: Topological Variables
                 // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
+                ( fTreeCascVarDCANegToPrimVtx > lCut.fDCANegToPV[lcfg] ) &
+                ( fTreeCascVarDCAPosToPrimVtx > lCut.fDCAPosToPV[lcfg] ) &
+                ( fTreeCascVarDCAV0Daughters < lCut.fDCAV0Daughters[lcfg] ) &
+                ( fTreeCascVarV0CosPointingAngle > lV0CosPACut ) &
+                ( fTreeCascVarV0Radius > lCut.fV0Radius[lcfg] ) &
                 // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lCascadeResult->GetCutDCACascDaughters() &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
+                ( fTreeCascVarDCAV0ToPrimVtx > lCut.fDCAV0ToPV[lcfg] ) &
+                ( TMath::Abs(lV0Mass[lHypo]-1.116) < lCut.fV0Mass[lcfg] ) &
+                ( fTreeCascVarDCABachToPrimVtx > lCut.fDCABachToPV[lcfg] ) &
+                ( fTreeCascVarDCACascDaughters < lCut.fDCACascDaughters[lcfg] ) &
+                ( fTreeCascVarCascCosPointingAngle > lCascCosPACut ) &
+                ( fTreeCascVarCascRadius > lCut.fCascRadius[lcfg] ) &
+
                 // - Implementation of a parametric V0 Mass cut if requested
                 (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
+                 ( lCut.fV0MassSigma[lcfg] > 50 ) || //anything goes
+                 (TMath::Abs( (lV0Mass[lHypo]-lExpV0Mass) / lExpV0Sigma ) < lCut.fV0MassSigma[lcfg] )
+                 ) &
+
                 // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
+                ( fTreeCascVarDistOverTotMom*lPDGMass[lHypo] < lCut.fProperLifetime[lcfg] ) &
+                ( fTreeCascVarLeastNbrClusters > lCut.fLeastNumberOfClusters[lcfg] ) &
+
                 //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
+                ( TMath::Abs(lNegdEdx [lHypo])<lCut.fTPCdEdx[lcfg] ) &
+                ( TMath::Abs(lPosdEdx [lHypo])<lCut.fTPCdEdx[lcfg] ) &
+                ( TMath::Abs(lBachdEdx[lHypo])<lCut.fTPCdEdx[lcfg] ) &
+
                 //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
+                ( !lCut.fXiRejectionUsed[lcfg] || lXiMassDifference > lCut.fXiRejection[lcfg] ) &
+
                 //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
+                ( fTreeCascVarDCABachToBaryon > lCut.fDCABachToBaryon[lcfg] ) &
+
                 //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
-                
+                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &
+
                 //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
+                ( fTreeCascVarV0Lifetime > lCut.fMinV0Lifetime[lcfg] ) &
+                ( fTreeCascVarV0Lifetime < lCut.fMaxV0Lifetime[lcfg] ||
+                 lCut.fMaxV0Lifetime[lcfg] > 1e+3 ) &
+
                 //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
+                ( lITSRefitTracks || !lCut.fUseITSRefitTracks[lcfg] ) &
+
                 //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster()
-                 )&&
-                
+                ( lCut.fMaxChi2PerCluster[lcfg]>1e+3 ||
+                 fTreeCascVarMaxChi2PerCluster < lCut.fMaxChi2PerCluster[lcfg]
+                 ) &
+
                 //Check 11: Min Track Length if positive
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                 )&&
-                
+                ( lCut.fMinTrackLength[lcfg]<0 || //this is a bit paranoid...
+                 fTreeCascVarMinTrackLength > lCut.fMinTrackLength[lcfg]
+                 ) &
+
                 //Check 12: Check if special V0 CosPA cut used
                 //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
+                ( !lCut.fUse276TeVV0CosPA[lcfg] ||
                  fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )
-                ){
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
-            }
+                 );
+        }
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+            //This satisfies all my conditionals! Fill histogram
+            if ( fCascadeCutTable.fPass[lcfg] ) fCascadeCutTable.fHistogram[lcfg] -> Fill ( fCentrality, fTreeCascVarPt, lMass[lCut.fMassHypothesis[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -3853,6 +3812,159 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddCascadeConfiguration276TeV
 }
 
 
+//________________________________________________________________________
+static Int_t AddVarCosPAParameterSet(std::vector<Float_t> &lParameters, const Float_t *lSet)
+//Returns the index of lSet in lParameters (5 values per set), appending it if new
+{
+    Int_t lNSets = lParameters.size()/5;
+    for(Int_t iset=0; iset<lNSets; iset++){
+        if ( std::equal(lSet, lSet+5, lParameters.begin()+5*iset) ) return iset;
+    }
+    lParameters.insert(lParameters.end(), lSet, lSet+5);
+    return lNSets;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildV0CutTable()
+//Unpacks the configurations of fListV0 into fV0CutTable
+{
+    fV0CutTable = V0CutTable();
+    Int_t lNumberOfConfigurations = fListV0->GetEntries();
+    V0CutTable &lCut = fV0CutTable;
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        Int_t lHypo = 3;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short    ) lHypo = AliV0Result::kK0Short;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda     ) lHypo = AliV0Result::kLambda;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda ) lHypo = AliV0Result::kAntiLambda;
+
+        lCut.fHistogram.push_back( lV0Result->GetHistogram() );
+        lCut.fMassHypothesis.push_back( lHypo );
+        lCut.fUseOnTheFly.push_back( lV0Result->GetUseOnTheFly() );
+        lCut.fMinEtaTracks.push_back( lV0Result->GetCutMinEtaTracks() );
+        lCut.fMaxEtaTracks.push_back( lV0Result->GetCutMaxEtaTracks() );
+        lCut.fMinRapidity.push_back( lV0Result->GetCutMinRapidity() );
+        lCut.fMaxRapidity.push_back( lV0Result->GetCutMaxRapidity() );
+        lCut.fV0Radius.push_back( lV0Result->GetCutV0Radius() );
+        lCut.fDCANegToPV.push_back( lV0Result->GetCutDCANegToPV() );
+        lCut.fDCAPosToPV.push_back( lV0Result->GetCutDCAPosToPV() );
+        lCut.fDCAV0Daughters.push_back( lV0Result->GetCutDCAV0Daughters() );
+        lCut.fV0CosPA.push_back( lV0Result->GetCutV0CosPA() );
+        Int_t lVarV0CosPA = -1;
+        if( lV0Result->GetCutUseVarV0CosPA() ){
+            Float_t lVarV0CosPApar[5];
+            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+            lVarV0CosPA = AddVarCosPAParameterSet(lCut.fVarV0CosPAPars, lVarV0CosPApar);
+        }
+        lCut.fVarV0CosPA.push_back( lVarV0CosPA );
+        lCut.fProperLifetime.push_back( lV0Result->GetCutProperLifetime() );
+        lCut.fLeastNumberOfCrossedRows.push_back( lV0Result->GetCutLeastNumberOfCrossedRows() );
+        lCut.fLeastNumberOfCrossedRowsOverFindable.push_back( lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+        lCut.fMinBaryonMomentum.push_back( lV0Result->GetCutMinBaryonMomentum() );
+        lCut.fTPCdEdx.push_back( lV0Result->GetCutTPCdEdx() );
+        lCut.fArmenteros.push_back( lV0Result->GetCutArmenteros() && lHypo == AliV0Result::kK0Short );
+        lCut.fArmenterosParameter.push_back( lV0Result->GetCutArmenterosParameter() );
+        lCut.fUseITSRefitTracks.push_back( lV0Result->GetCutUseITSRefitTracks() );
+        lCut.fMaxChi2PerCluster.push_back( lV0Result->GetCutMaxChi2PerCluster() );
+        lCut.fMinTrackLength.push_back( lV0Result->GetCutMinTrackLength() );
+    }
+    lCut.fVarV0CosPAValue.resize( lCut.fVarV0CosPAPars.size()/5 );
+    lCut.fPass.resize( lNumberOfConfigurations );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCascadeCutTable()
+//Unpacks the configurations of fListCascade into fCascadeCutTable
+{
+    fCascadeCutTable = CascadeCutTable();
+    Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+    CascadeCutTable &lCut = fCascadeCutTable;
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        Int_t lHypo = 4;
+        Int_t lCharge = -2;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    ){ lHypo = AliCascadeResult::kXiMinus;    lCharge = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     ){ lHypo = AliCascadeResult::kXiPlus;     lCharge = +1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ){ lHypo = AliCascadeResult::kOmegaMinus; lCharge = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ){ lHypo = AliCascadeResult::kOmegaPlus;  lCharge = +1; }
+        if ( lHypo != 4 && lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+
+        lCut.fHistogram.push_back( lCascadeResult->GetHistogram() );
+        lCut.fMassHypothesis.push_back( lHypo );
+        lCut.fCharge.push_back( lCharge );
+        lCut.fXiRejectionUsed.push_back( lHypo == AliCascadeResult::kOmegaMinus || lHypo == AliCascadeResult::kOmegaPlus );
+        lCut.fMinEtaTracks.push_back( lCascadeResult->GetCutMinEtaTracks() );
+        lCut.fMaxEtaTracks.push_back( lCascadeResult->GetCutMaxEtaTracks() );
+        lCut.fMinRapidity.push_back( lCascadeResult->GetCutMinRapidity() );
+        lCut.fMaxRapidity.push_back( lCascadeResult->GetCutMaxRapidity() );
+        lCut.fDCANegToPV.push_back( lCascadeResult->GetCutDCANegToPV() );
+        lCut.fDCAPosToPV.push_back( lCascadeResult->GetCutDCAPosToPV() );
+        lCut.fDCAV0Daughters.push_back( lCascadeResult->GetCutDCAV0Daughters() );
+        lCut.fV0CosPA.push_back( lCascadeResult->GetCutV0CosPA() );
+        Int_t lVarV0CosPA = -1;
+        if( lCascadeResult->GetCutUseVarV0CosPA() ){
+            Float_t lVarV0CosPApar[5];
+            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+            lVarV0CosPA = AddVarCosPAParameterSet(lCut.fVarV0CosPAPars, lVarV0CosPApar);
+        }
+        lCut.fVarV0CosPA.push_back( lVarV0CosPA );
+        lCut.fV0Radius.push_back( lCascadeResult->GetCutV0Radius() );
+        lCut.fDCAV0ToPV.push_back( lCascadeResult->GetCutDCAV0ToPV() );
+        lCut.fV0Mass.push_back( lCascadeResult->GetCutV0Mass() );
+        lCut.fDCABachToPV.push_back( lCascadeResult->GetCutDCABachToPV() );
+        lCut.fDCACascDaughters.push_back( lCascadeResult->GetCutDCACascDaughters() );
+        lCut.fCascCosPA.push_back( lCascadeResult->GetCutCascCosPA() );
+        Int_t lVarCascCosPA = -1;
+        if( lCascadeResult->GetCutUseVarCascCosPA() ){
+            Float_t lVarCascCosPApar[5];
+            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+            lVarCascCosPA = AddVarCosPAParameterSet(lCut.fVarCascCosPAPars, lVarCascCosPApar);
+        }
+        lCut.fVarCascCosPA.push_back( lVarCascCosPA );
+        lCut.fCascRadius.push_back( lCascadeResult->GetCutCascRadius() );
+        lCut.fV0MassSigma.push_back( lCascadeResult->GetCutV0MassSigma() );
+        lCut.fProperLifetime.push_back( lCascadeResult->GetCutProperLifetime() );
+        lCut.fLeastNumberOfClusters.push_back( lCascadeResult->GetCutLeastNumberOfClusters() );
+        lCut.fTPCdEdx.push_back( lCascadeResult->GetCutTPCdEdx() );
+        lCut.fXiRejection.push_back( lCascadeResult->GetCutXiRejection() );
+        lCut.fDCABachToBaryon.push_back( lCascadeResult->GetCutDCABachToBaryon() );
+        lCut.fBachBaryonCosPA.push_back( lCascadeResult->GetCutBachBaryonCosPA() );
+        Int_t lVarBBCosPA = -1;
+        if( lCascadeResult->GetCutUseVarBBCosPA() ){
+            Float_t lVarBBCosPApar[5];
+            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+            lVarBBCosPA = AddVarCosPAParameterSet(lCut.fVarBBCosPAPars, lVarBBCosPApar);
+        }
+        lCut.fVarBBCosPA.push_back( lVarBBCosPA );
+        lCut.fMinV0Lifetime.push_back( lCascadeResult->GetCutMinV0Lifetime() );
+        lCut.fMaxV0Lifetime.push_back( lCascadeResult->GetCutMaxV0Lifetime() );
+        lCut.fUseITSRefitTracks.push_back( lCascadeResult->GetCutUseITSRefitTracks() );
+        lCut.fMaxChi2PerCluster.push_back( lCascadeResult->GetCutMaxChi2PerCluster() );
+        lCut.fMinTrackLength.push_back( lCascadeResult->GetCutMinTrackLength() );
+        lCut.fUse276TeVV0CosPA.push_back( lCascadeResult->GetCutUse276TeVV0CosPA() );
+    }
+    lCut.fVarV0CosPAValue.resize( lCut.fVarV0CosPAPars.size()/5 );
+    lCut.fVarCascCosPAValue.resize( lCut.fVarCascCosPAPars.size()/5 );
+    lCut.fVarBBCosPAValue.resize( lCut.fVarBBCosPAPars.size()/5 );
+    lCut.fPass.resize( lNumberOfConfigurationsCascade );
+}
+
 //________________________________________________________________________
 Float_t AliAnalysisTaskStrangenessVsMultiplicityRun2::GetDCAz(AliESDtrack *lTrack)
 //Encapsulation of DCAz calculation
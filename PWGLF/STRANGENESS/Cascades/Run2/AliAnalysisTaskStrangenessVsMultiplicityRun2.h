@@ -477,6 +477,91 @@ private:
     TH1D *fHistEventCounter; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Cut tables for the superlight adaptive output mode
+//===========================================================================================
+    // The AliV0Result / AliCascadeResult configurations are unpacked once into one
+    // column per selection, so that every candidate is tested against all of them in a
+    // single pass. Variable CosPA parameter sets shared by several configurations are
+    // stored once and evaluated once per candidate.
+    struct V0CutTable {
+        std::vector<TH3F*>    fHistogram;                  // output histogram
+        std::vector<Int_t>    fMassHypothesis;             // AliV0Result::EMassHypo, 3 if none
+        std::vector<Int_t>    fUseOnTheFly;
+        std::vector<Double_t> fMinEtaTracks;
+        std::vector<Double_t> fMaxEtaTracks;
+        std::vector<Double_t> fMinRapidity;
+        std::vector<Double_t> fMaxRapidity;
+        std::vector<Double_t> fV0Radius;
+        std::vector<Double_t> fDCANegToPV;
+        std::vector<Double_t> fDCAPosToPV;
+        std::vector<Double_t> fDCAV0Daughters;
+        std::vector<Float_t>  fV0CosPA;
+        std::vector<Int_t>    fVarV0CosPA;                 // parameter set in fVarV0CosPAPars, -1 if not used
+        std::vector<Double_t> fProperLifetime;
+        std::vector<Double_t> fLeastNumberOfCrossedRows;
+        std::vector<Double_t> fLeastNumberOfCrossedRowsOverFindable;
+        std::vector<Double_t> fMinBaryonMomentum;
+        std::vector<Double_t> fTPCdEdx;
+        std::vector<Int_t>    fArmenteros;                 // Armenteros cut applied (K0Short only)
+        std::vector<Double_t> fArmenterosParameter;
+        std::vector<Int_t>    fUseITSRefitTracks;
+        std::vector<Double_t> fMaxChi2PerCluster;
+        std::vector<Double_t> fMinTrackLength;
+        std::vector<Float_t>  fVarV0CosPAPars;             // 5 parameters per distinct set
+        std::vector<Float_t>  fVarV0CosPAValue;            // value of each set for the current candidate
+        std::vector<UChar_t>  fPass;                       // selection result for the current candidate
+    };
+    struct CascadeCutTable {
+        std::vector<TH3F*>    fHistogram;                  // output histogram
+        std::vector<Int_t>    fMassHypothesis;             // AliCascadeResult::EMassHypo, 4 if none
+        std::vector<Int_t>    fCharge;                     // expected charge (bachelor swap included)
+        std::vector<Int_t>    fXiRejectionUsed;            // Omega hypothesis
+        std::vector<Double_t> fMinEtaTracks;
+        std::vector<Double_t> fMaxEtaTracks;
+        std::vector<Double_t> fMinRapidity;
+        std::vector<Double_t> fMaxRapidity;
+        std::vector<Double_t> fDCANegToPV;
+        std::vector<Double_t> fDCAPosToPV;
+        std::vector<Double_t> fDCAV0Daughters;
+        std::vector<Float_t>  fV0CosPA;
+        std::vector<Int_t>    fVarV0CosPA;                 // parameter set in fVarV0CosPAPars, -1 if not used
+        std::vector<Double_t> fV0Radius;
+        std::vector<Double_t> fDCAV0ToPV;
+        std::vector<Double_t> fV0Mass;
+        std::vector<Double_t> fDCABachToPV;
+        std::vector<Double_t> fDCACascDaughters;
+        std::vector<Float_t>  fCascCosPA;
+        std::vector<Int_t>    fVarCascCosPA;               // parameter set in fVarCascCosPAPars, -1 if not used
+        std::vector<Double_t> fCascRadius;
+        std::vector<Double_t> fV0MassSigma;
+        std::vector<Double_t> fProperLifetime;
+        std::vector<Double_t> fLeastNumberOfClusters;
+        std::vector<Double_t> fTPCdEdx;
+        std::vector<Double_t> fXiRejection;
+        std::vector<Double_t> fDCABachToBaryon;
+        std::vector<Float_t>  fBachBaryonCosPA;
+        std::vector<Int_t>    fVarBBCosPA;                 // parameter set in fVarBBCosPAPars, -1 if not used
+        std::vector<Double_t> fMinV0Lifetime;
+        std::vector<Double_t> fMaxV0Lifetime;
+        std::vector<Int_t>    fUseITSRefitTracks;
+        std::vector<Double_t> fMaxChi2PerCluster;
+        std::vector<Double_t> fMinTrackLength;
+        std::vector<Int_t>    fUse276TeVV0CosPA;
+        std::vector<Float_t>  fVarV0CosPAPars;             // 5 parameters per distinct set
+        std::vector<Float_t>  fVarV0CosPAValue;            // value of each set for the current candidate
+        std::vector<Float_t>  fVarCascCosPAPars;
+        std::vector<Float_t>  fVarCascCosPAValue;
+        std::vector<Float_t>  fVarBBCosPAPars;
+        std::vector<Float_t>  fVarBBCosPAValue;
+        std::vector<UChar_t>  fPass;                       // selection result for the current candidate
+    };
+    void BuildV0CutTable();
+    void BuildCascadeCutTable();
+
+    V0CutTable      fV0CutTable;      //! configurations of fListV0, built at the first event
+    CascadeCutTable fCascadeCutTable; //! configurations of fListCascade, built at the first event
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
@@ -54,6 +54,7 @@ class AliAODv0;
 #include "TRandom3.h"
 #include "TLorentzVector.h"
 #include "TObjectTable.h"
+#include "TArrayD.h"
 //#include "AliLog.h"
 
 #include "AliESDEvent.h"
@@ -500,6 +501,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     TArrayI neg(nentr);
     TArrayI pos(nentr);
+    //Impact parameters and pre-selection values (see GetPreselectionValues)
+    TArrayD negD(nentr), negValues(11*nentr);
+    TArrayD posD(nentr), posValues(11*nentr);
     
     Long_t nneg=0, npos=0, nvtx=0;
     
@@ -520,8 +524,15 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
-        if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
-        else pos[npos++]=i;
+        if (esdTrack->GetSign() < 0.) {
+            negD[nneg]=TMath::Abs(d);
+            GetPreselectionValues(esdTrack, b, negValues.GetArray()+11*nneg);
+            neg[nneg++]=i;
+        } else {
+            posD[npos]=TMath::Abs(d);
+            GetPreselectionValues(esdTrack, b, posValues.GetArray()+11*npos);
+            pos[npos++]=i;
+        }
     }
     
     
@@ -531,7 +542,6 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         
         for (Int_t k=0; k<npos; k++) {
             Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
             
             //Pre-select dE/dx: only proceed if at least one of these tracks looks like a proton
             /*
@@ -542,9 +552,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
              }
              */
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (negD[i]<fV0VertexerSels[1])
+                if (posD[k]<fV0VertexerSels[2]) continue;
             
+            //Skip pairs that cannot pass the DCA cut before copying and propagating
+            if (GetDCAV0DauLowerBound(negValues.GetArray()+11*i, posValues.GetArray()+11*k) > fV0VertexerSels[3]) continue;
+            
+            AliESDtrack *ptrk=event->GetTrack(pidx);
             AliExternalTrackParam nt(*ntrk), pt(*ptrk), *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
             
@@ -730,9 +744,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     }
     nV0=vtcs.GetEntriesFast();
     
-    // stores relevant tracks in another array
+    // stores relevant tracks in two arrays, one per bachelor charge,
+    // with their pre-selection values (see GetPreselectionValues)
     Long_t nentr=(Int_t)event->GetNumberOfTracks();
-    TArrayI trk(nentr); Long_t ntr=0;
+    TArrayI trkNeg(nentr); Long_t nneg=0; TArrayD negValues(11*nentr);
+    TArrayI trkPos(nentr); Long_t npos=0; TArrayD posValues(11*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         ULong_t status=esdtr->GetStatus();
@@ -746,8 +762,16 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         if (esdtr->GetTPCNcls() < 70 && lThisTrackLength<80 ) continue;
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
-        trk[ntr++]=i;
+        if (esdtr->GetSign()<=0) {
+            GetPreselectionValues(esdtr, b, negValues.GetArray()+11*nneg);
+            trkNeg[nneg++]=i;
+        }
+        if (esdtr->GetSign()>=0) {
+            GetPreselectionValues(esdtr, b, posValues.GetArray()+11*npos);
+            trkPos[npos++]=i;
+        }
     }
+    Double_t lV0Values[11];
     
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
@@ -758,14 +782,16 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        GetPreselectionValues(&v0, lV0Values);
+        for (Int_t j=0; j<nneg; j++) {//loop on tracks (bachelor's charge)
+            Int_t bidx=trkNeg[j];
             //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
             
-            AliESDtrack *btrk=event->GetTrack(bidx);
+            //Skip pairs that cannot pass the DCA cut before copying and propagating
+            if (GetDCACascDauLowerBound(lV0Values, negValues.GetArray()+11*j) > fCascadeVertexerSels[4]) continue;
             
-            if (btrk->GetSign()>0) continue;  // bachelor's charge
+            AliESDtrack *btrk=event->GetTrack(bidx);
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
@@ -926,14 +952,16 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+        GetPreselectionValues(&v0, lV0Values);
         
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        for (Int_t j=0; j<npos; j++) {//loop on tracks (bachelor's charge)
+            Int_t bidx=trkPos[j];
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
             
-            AliESDtrack *btrk=event->GetTrack(bidx);
+            //Skip pairs that cannot pass the DCA cut before copying and propagating
+            if (GetDCACascDauLowerBound(lV0Values, posValues.GetArray()+11*j) > fCascadeVertexerSels[4]) continue;
             
-            if (btrk->GetSign()<0) continue;  // bachelor's charge
+            AliESDtrack *btrk=event->GetTrack(bidx);
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
@@ -1220,9 +1248,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
     
     nV0=vtcs.GetEntriesFast();
     
-    // stores candidate bachelor tracks in another array
+    // stores candidate bachelor tracks in another array, with their
+    // pre-selection values (see GetPreselectionValues)
     Int_t nentr=(Int_t)event->GetNumberOfTracks();
-    TArrayI trk(nentr); Int_t ntr=0;
+    TArrayI trk(nentr); Int_t ntr=0; TArrayD trkValues(11*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         
@@ -1238,8 +1267,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
         
+        GetPreselectionValues(esdtr, b, trkValues.GetArray()+11*ntr);
         trk[ntr++]=i;
     }
+    Double_t lV0Values[11];
     
     Double_t massLambda=1.11568;
     Int_t ncasc=0;
@@ -1263,6 +1294,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         //Only disregard if it does not pass any of the desired hypotheses
         if (TMath::Abs(lMassAsLambda-massLambda)>fCascadeVertexerSels[2] &&
             TMath::Abs(lMassAsAntiLambda-massLambda)>fCascadeVertexerSels[2]) continue;
+        GetPreselectionValues(&v0, lV0Values);
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
             Int_t bidx=trk[j];
@@ -1271,6 +1303,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
             if (v0.GetIndex(0)==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
             
+            //Skip pairs that cannot pass the DCA cut before copying and propagating
+            if (GetDCACascDauLowerBound(lV0Values, trkValues.GetArray()+11*j) > fCascadeVertexerSels[4]) continue;
+            
             AliESDtrack *btrk=event->GetTrack(bidx);
             
             //Do not check charges!
@@ -2184,3 +2219,90 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     center[1] =	ypos + ypoint;
     return;
 }
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetPreselectionValues(const AliExternalTrackParam *track, Double_t b, Double_t lValues[11]) const
+{
+    // Stores what the pair pre-selection needs to know about a track:
+    // position (0-2), momentum (3-5), center (6-7) and radius (8, -1 if straight)
+    // of the helix in XY, SigmaY2 (9) and SigmaZ2 (10)
+    track->GetXYZ(lValues);
+    track->GetPxPyPz(lValues+3);
+    Double_t lHelix[6];
+    track->GetHelixParameters(lHelix,b);
+    lValues[6] = 0.;
+    lValues[7] = 0.;
+    lValues[8] = -1.;
+    if (TMath::Abs(lHelix[4])>kAlmost0) {
+        //see Evaluate: the point at phase phi is (lHelix[5]+(sin(phi)-sin(phi0))/C, lHelix[0]-(cos(phi)-cos(phi0))/C)
+        lValues[6] = lHelix[5] - TMath::Sin(lHelix[2])/lHelix[4];
+        lValues[7] = lHelix[0] + TMath::Cos(lHelix[2])/lHelix[4];
+        lValues[8] = TMath::Abs(1./lHelix[4]);
+    }
+    lValues[9]  = track->GetSigmaY2();
+    lValues[10] = track->GetSigmaZ2();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetPreselectionValues(const AliESDv0 *v0, Double_t lValues[11]) const
+{
+    // Stores position (0-2) and momentum (3-5) of a V0, the rest is unused
+    v0->GetXYZ(lValues[0],lValues[1],lValues[2]);
+    v0->GetPxPyPz(lValues[3],lValues[4],lValues[5]);
+    for(Int_t ii=6; ii<11; ii++) lValues[ii] = 0.;
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetDCAV0DauLowerBound(const Double_t *lNegValues, const Double_t *lPosValues) const
+{
+    // Lower bound of the weighted DCA returned by GetDCAV0Dau or
+    // AliExternalTrackParam::GetDCA. Both return sqrt(dm*sqrt(dy2*dz2)) for two
+    // points on the helices, with dm >= dXY^2/dy2, and the XY distance of two
+    // points on the helices is at least the distance of the two circles.
+    // Pairs above the V0 daughter DCA cut can thus be skipped before the
+    // tracks are copied and propagated.
+    if( lNegValues[8]<0 || lPosValues[8]<0 ) return 0.;
+    Double_t lDist = TMath::Sqrt(
+                                 TMath::Power( lNegValues[6] - lPosValues[6] , 2) +
+                                 TMath::Power( lNegValues[7] - lPosValues[7] , 2)
+                                 );
+    Double_t lDCAxy = 0.;
+    if( lDist > lNegValues[8] + lPosValues[8] ) lDCAxy = lDist - lNegValues[8] - lPosValues[8];
+    if( lDist < TMath::Abs(lNegValues[8] - lPosValues[8]) ) lDCAxy = TMath::Abs(lNegValues[8] - lPosValues[8]) - lDist;
+    //Safety margin for the rounding of the helix evaluation at large radii
+    lDCAxy -= 1e-9*(lDist + lNegValues[8] + lPosValues[8]) + 1e-6;
+    if( lDCAxy <= 0. ) return 0.;
+    Double_t dy2 = lNegValues[9]  + lPosValues[9];
+    Double_t dz2 = lNegValues[10] + lPosValues[10];
+    if( dy2 <= 0. || dz2 <= 0. ) return 0.;
+    return lDCAxy*TMath::Sqrt(TMath::Sqrt(dz2/dy2));
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetDCACascDauLowerBound(const Double_t *lV0Values, const Double_t *lBachValues) const
+{
+    // Lower bound of the DCA returned by PropagateToDCA, so that pairs above
+    // the cascade daughter DCA cut can be skipped before the bachelor is
+    // copied and propagated
+    if ( !fkDoImprovedCascadeVertexFinding ){
+        //Linear: DCA between the straight lines through the bachelor position
+        //and the V0 vertex, calculated exactly as in PropagateToDCA
+        Double_t x1=lBachValues[0], y1=lBachValues[1], z1=lBachValues[2];
+        Double_t px1=lBachValues[3], py1=lBachValues[4], pz1=lBachValues[5];
+        Double_t x2=lV0Values[0], y2=lV0Values[1], z2=lV0Values[2];
+        Double_t px2=lV0Values[3], py2=lV0Values[4], pz2=lV0Values[5];
+        Double_t dd= Det(x2-x1,y2-y1,z2-z1,px1,py1,pz1,px2,py2,pz2);
+        Double_t ax= Det(py1,pz1,py2,pz2);
+        Double_t ay=-Det(px1,pz1,px2,pz2);
+        Double_t az= Det(px1,py1,px2,py2);
+        return TMath::Abs(dd)/TMath::Sqrt(ax*ax + ay*ay + az*az) - 1e-6;
+    }
+    //Improved: distance of a point of the bachelor helix to the V0 line,
+    //at least the XY distance between the helix circle and the V0 line
+    if( lBachValues[8]<0 ) return 0.;
+    Double_t lV0Pt = TMath::Sqrt( lV0Values[3]*lV0Values[3] + lV0Values[4]*lV0Values[4] );
+    if( lV0Pt <= 0. ) return 0.;
+    Double_t lDist = TMath::Abs( (lBachValues[6]-lV0Values[0])*lV0Values[4] - (lBachValues[7]-lV0Values[1])*lV0Values[3] )/lV0Pt;
+    //Safety margin for the rounding of the helix evaluation at large radii
+    return lDist - lBachValues[8] - 1e-9*(lDist + lBachValues[8]) - 1e-6;
+}
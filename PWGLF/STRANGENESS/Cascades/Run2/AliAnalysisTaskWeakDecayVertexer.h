@@ -196,6 +196,12 @@ public:
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
     //---------------------------------------------------------------------------------------
+    //Pair pre-selection: lower bounds of the DCAs, from values stored once per track / V0
+    void GetPreselectionValues(const AliExternalTrackParam *track, Double_t b, Double_t lValues[11]) const;
+    void GetPreselectionValues(const AliESDv0 *v0, Double_t lValues[11]) const;
+    Double_t GetDCAV0DauLowerBound(const Double_t *lNegValues, const Double_t *lPosValues) const;
+    Double_t GetDCACascDauLowerBound(const Double_t *lV0Values, const Double_t *lBachValues) const;
+    //---------------------------------------------------------------------------------------
 
 private:
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
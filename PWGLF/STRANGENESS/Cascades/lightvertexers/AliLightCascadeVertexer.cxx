@@ -25,6 +25,7 @@
 //modified by I. Belikov 24/11/2006 : static setter for the default cuts
 
 #include "AliESDEvent.h"
+#include "TArrayD.h"
 #include "AliESDcascade.h"
 #include "AliLightCascadeVertexer.h"
 
@@ -137,9 +138,11 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
    }
    nV0=vtcs.GetEntriesFast();
 
-   // stores relevant tracks in another array
+   // stores relevant tracks in two arrays, one per bachelor charge,
+   // together with their position and momentum for the pair pre-selection
    Int_t nentr=(Int_t)event->GetNumberOfTracks();
-   TArrayI trk(nentr); Int_t ntr=0;
+   TArrayI trkNeg(nentr); Int_t nneg=0; TArrayD xyzpNeg(6*nentr);
+   TArrayI trkPos(nentr); Int_t npos=0; TArrayD xyzpPos(6*nentr);
    for (i=0; i<nentr; i++) {
        AliESDtrack *esdtr=event->GetTrack(i);
        ULong_t status=esdtr->GetStatus();
@@ -152,9 +155,22 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
 
        if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDBachMin) continue;
 
-       trk[ntr++]=i;
+       if (esdtr->GetSign()<=0) {
+         esdtr->GetXYZ(xyzpNeg.GetArray()+6*nneg); esdtr->GetPxPyPz(xyzpNeg.GetArray()+6*nneg+3);
+         trkNeg[nneg++]=i;
+       }
+       if (esdtr->GetSign()>=0) {
+         esdtr->GetXYZ(xyzpPos.GetArray()+6*npos); esdtr->GetPxPyPz(xyzpPos.GetArray()+6*npos+3);
+         trkPos[npos++]=i;
+       }
    }   
 
+   // The V0-bachelor DCA computed in PropagateToDCA is the one of the straight
+   // lines through the V0 vertex and the current track position: it is
+   // evaluated first on the stored values and the track is only copied and
+   // propagated if it can pass fDCAmax (the margin covers rounding)
+   const Double_t kDCAPreselectionMargin=1.e-6;
+
    Double_t massLambda=1.11568;
    Int_t ncasc=0;
 
@@ -167,17 +183,22 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
       v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda 
       if (TMath::Abs(v0.GetEffMass()-massLambda)>fMassWin) continue; 
 
+      Double_t rV0[3], pV0[3]; v0.GetXYZ(rV0[0],rV0[1],rV0[2]); v0.GetPxPyPz(pV0[0],pV0[1],pV0[2]);
+      // bachelor's charge
+      const Int_t ntr = fSwitchCharges ? npos : nneg;
+      const TArrayI &trk = fSwitchCharges ? trkPos : trkNeg;
+      const Double_t *xyzp = fSwitchCharges ? xyzpPos.GetArray() : xyzpNeg.GetArray();
+
       for (Int_t j=0; j<ntr; j++) {//loop on tracks
 	 Int_t bidx=trk[j];
  	 //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
           if (!fSwitchCharges && bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
           if ( fSwitchCharges && bidx==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
           
+          if (GetStraightLineDCA(xyzp+6*j,xyzp+6*j+3,rV0,pV0) > fDCAmax+kDCAPreselectionMargin) continue;
+
           AliESDtrack *btrk=event->GetTrack(bidx);
           
-         if (!fSwitchCharges && btrk->GetSign()>0) continue;  // bachelor's charge
-         if ( fSwitchCharges && btrk->GetSign()<0) continue;  // bachelor's charge
-          
     	 AliESDv0 *pv0=&v0;
          AliExternalTrackParam bt(*btrk), *pbt=&bt;
 
@@ -218,17 +239,22 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
       v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda 
       if (TMath::Abs(v0.GetEffMass()-massLambda)>fMassWin) continue; 
 
+      Double_t rV0[3], pV0[3]; v0.GetXYZ(rV0[0],rV0[1],rV0[2]); v0.GetPxPyPz(pV0[0],pV0[1],pV0[2]);
+      // bachelor's charge
+      const Int_t ntr = fSwitchCharges ? nneg : npos;
+      const TArrayI &trk = fSwitchCharges ? trkNeg : trkPos;
+      const Double_t *xyzp = fSwitchCharges ? xyzpNeg.GetArray() : xyzpPos.GetArray();
+
       for (Int_t j=0; j<ntr; j++) {//loop on tracks
 	 Int_t bidx=trk[j];
  	 //Bo:   if (bidx==v->GetPindex()) continue; //bachelor and v0's positive tracks must be different
          if (!fSwitchCharges && bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
          if ( fSwitchCharges && bidx==v0.GetIndex(0)) continue; //Bo:  consistency 1 for pos
           
+          if (GetStraightLineDCA(xyzp+6*j,xyzp+6*j+3,rV0,pV0) > fDCAmax+kDCAPreselectionMargin) continue;
+
           AliESDtrack *btrk=event->GetTrack(bidx);
           
-         if (!fSwitchCharges && btrk->GetSign()<0) continue;  // bachelor's charge
-         if ( fSwitchCharges && btrk->GetSign()>0) continue;  // bachelor's charge
-          
 	 AliESDv0 *pv0=&v0;
          AliExternalTrackParam bt(*btrk), *pbt=&bt;
 
@@ -284,6 +310,26 @@ Double_t AliLightCascadeVertexer::Det(Double_t a00,Double_t a01,Double_t a02,
   return  a00*Det(a11,a12,a21,a22)-a01*Det(a10,a12,a20,a22)+a02*Det(a10,a11,a20,a21);
 }
 
+Double_t AliLightCascadeVertexer::GetStraightLineDCA(const Double_t *r1, const Double_t *p1,
+						    const Double_t *r2, const Double_t *p2) const {
+  //--------------------------------------------------------------------
+  // This function returns the DCA between the straight line through r1
+  // along p1 (track) and the one through r2 along p2 (V0), computed as in
+  // PropagateToDCA
+  //--------------------------------------------------------------------
+  Double_t x1=r1[0], y1=r1[1], z1=r1[2];
+  Double_t px1=p1[0], py1=p1[1], pz1=p1[2];
+  Double_t x2=r2[0], y2=r2[1], z2=r2[2];
+  Double_t px2=p2[0], py2=p2[1], pz2=p2[2];
+
+  Double_t dd= Det(x2-x1,y2-y1,z2-z1,px1,py1,pz1,px2,py2,pz2);
+  Double_t ax= Det(py1,pz1,py2,pz2);
+  Double_t ay=-Det(px1,pz1,px2,pz2);
+  Double_t az= Det(px1,py1,px2,py2);
+
+  return TMath::Abs(dd)/TMath::Sqrt(ax*ax + ay*ay + az*az);
+}
+
 Double_t AliLightCascadeVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackParam *t, Double_t b) {
   //--------------------------------------------------------------------
   // This function returns the DCA between the V0 and the track
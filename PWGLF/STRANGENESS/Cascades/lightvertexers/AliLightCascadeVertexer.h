@@ -29,6 +29,7 @@ public:
 	       Double_t a20,Double_t a21,Double_t a22) const;
 
   Double_t PropagateToDCA(AliESDv0 *vtx,AliExternalTrackParam *trk,Double_t b);
+  Double_t GetStraightLineDCA(const Double_t *r1, const Double_t *p1, const Double_t *r2, const Double_t *p2) const;
     void CheckChargeV0(AliESDv0 *v0);
 
   void GetCuts(Double_t cuts[8]) const;
@@ -17,6 +17,7 @@
 
 #include <TChain.h>
 #include <TFile.h>
+#include <TStopwatch.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
@@ -41,7 +42,10 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTimeSupplies(kFALSE),
+           fSupplyRealTime(),
+           fSupplyCpuTime()
 {
 // Dummy constructor
 }
@@ -58,7 +62,10 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTimeSupplies(kFALSE),
+           fSupplyRealTime(),
+           fSupplyCpuTime()
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -170,9 +177,25 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  Int_t nsupplies = fSupplies ? fSupplies->GetEntriesFast() : 0;
+  if (fTimeSupplies) {
+    if (fSupplyRealTime.GetSize() != nsupplies) {
+      fSupplyRealTime.Set(nsupplies);
+      fSupplyCpuTime.Set(nsupplies);
+    }
+    TStopwatch timer;
+    for (Int_t i=0; i<nsupplies; i++) {
+      timer.Start(kTRUE);
+      ((AliTenderSupply*)fSupplies->UncheckedAt(i))->ProcessEvent();
+      timer.Stop();
+      fSupplyRealTime[i] += timer.RealTime();
+      fSupplyCpuTime[i] += timer.CpuTime();
+    }
+  } else {
+    TIter next(fSupplies);
+    AliTenderSupply *supply;
+    while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -181,6 +204,21 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::FinishTaskOutput()
+{
+// Print the time spent in each supply (of this worker) if requested.
+  if (!fTimeSupplies) return;
+  Int_t nsupplies = fSupplyRealTime.GetSize();
+  Double_t total = 0.;
+  for (Int_t i=0; i<nsupplies; i++) {
+    Printf("AliTender: supply %-30s real time %10.3f s CPU time %10.3f s",
+           fSupplies->UncheckedAt(i)->GetName(), fSupplyRealTime[i], fSupplyCpuTime[i]);
+    total += fSupplyRealTime[i];
+  }
+  Printf("AliTender: %d supplies, real time %.3f s", nsupplies, total);
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
@@ -16,6 +16,9 @@
 #ifndef ALIANALYSISTASKSE_H
 #include "AliAnalysisTaskSE.h"
 #endif
+#ifndef ROOT_TArrayD
+#include "TArrayD.h"
+#endif
 
 // #ifndef ALIESDINPUTHANDLER_H
 // #include "AliESDInputHandler.h"
@@ -43,6 +46,9 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Bool_t                    fTimeSupplies;   // Switch on/off timing of the supplies
+  TArrayD                   fSupplyRealTime; //! Real time spent in each supply
+  TArrayD                   fSupplyCpuTime;  //! CPU time spent in each supply
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -68,13 +74,18 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Time each supply and print the time spent in each one at the end of the event loop
+   */
+  void                      SetTimeSupplies(Bool_t flag=kTRUE) {fTimeSupplies = flag;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
   virtual void              UserCreateOutputObjects();
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
+  virtual void              FinishTaskOutput();
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif